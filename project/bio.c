@@ -25,6 +25,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "vmstat.h"
 
 struct {
   struct spinlock lock;
@@ -33,6 +34,8 @@ struct {
   // Linked list of all buffers, through prev/next.
   // head.next is most recently used.
   struct buf head;
+  uint hits;
+  uint misses;
 } bcache;
 
 void
@@ -69,6 +72,7 @@ bget(uint dev, uint blockno)
   for(b = bcache.head.next; b != &bcache.head; b = b->next){
     if(b->dev == dev && b->blockno == blockno){
       b->refcnt++;
+      bcache.hits++;
       release(&bcache.lock);
       acquiresleep(&b->lock);
       return b;
@@ -84,6 +88,7 @@ bget(uint dev, uint blockno)
       b->blockno = blockno;
       b->flags = 0;
       b->refcnt = 1;
+      bcache.misses++;
       release(&bcache.lock);
       acquiresleep(&b->lock);
       return b;
@@ -139,6 +144,16 @@ brelse(struct buf *b)
   
   release(&bcache.lock);
 }
+
+void
+bcachestat(struct vmstat *st)
+{
+  acquire(&bcache.lock);
+  st->bcache_hits = bcache.hits;
+  st->bcache_misses = bcache.misses;
+  release(&bcache.lock);
+}
+
 //PAGEBREAK!
 // Blank page.
 
@@ -7,6 +7,9 @@ struct buf {
   struct buf *prev; // LRU cache list
   struct buf *next;
   struct buf *qnext; // disk queue
+  uchar **pages;     // if set, transfer nblocks blocks to/from these
+  uint nblocks;      //   pages, in order, instead of data
+  uint xfer;         // sectors moved so far
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
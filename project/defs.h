@@ -10,6 +10,8 @@ struct sleeplock;
 struct stat;
 struct superblock;
 struct swap_slot;
+struct vmstat;
+struct vma;
 typedef uint pte_t;
 #define PTE_SWAP 0x008
 
@@ -18,6 +20,7 @@ void            binit(void);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bcachestat(struct vmstat*);
 
 // console.c
 void            consoleinit(void);
@@ -27,6 +30,8 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+int             execload(char*, char**, pde_t**, uint*, uint*, uint*, struct vma*, struct proc*);
+char*           execname(char*);
 
 // file.c
 struct file*    filealloc(void);
@@ -43,6 +48,7 @@ int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+void            iexecmap(struct inode*, int);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
@@ -68,23 +74,66 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kalloc_zeroed(void);
+void            kzero_idle(void);
+void            kzerod(void);
+void            kswapd(void);
+char*           kalloc_order(int);
+void            kfree_order(char*, int);
 uint            num_of_FreePages(void);
 void            kfree(char*);
-pte_t *         mylist(uint, int);
+int             rmap_ptes(uint, pte_t**, int);
+int             rmap_wrprotect(uint, pte_t**, int);
+int             rmap_merge(uint, uint, pte_t**, int);
+int             rmap_mkwrite(uint, pte_t*);
+int             rmap_referenced(uint);
+int             kref_get(uint, pte_t*);
+int             kref_drop(uint);
+void            kref_put(uint);
+int             rmap_set(uint, pte_t*, pte_t);
+int             rmap_dup(uint, pte_t*, pte_t*);
+int             rmap_reserve(int);
+void            rmap_unreserve(int);
+void            rmap_map(uint, pte_t*, pte_t);
+int             rmap_unmap(uint, uint, pte_t**, uint*, int);
+void            kmemstat(struct vmstat*);
+void            kpin(char*);
+int             kunpin(char*);
+int             kpinned(uint);
+void            pgtab_setpdx(char*, uint);
+uint            pte2va(pte_t*);
+void            pgtab_ref(char*);
+int             pgtab_unref(char*);
+int             pgtab_nref(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 //new functions
-void            update_ref_count(uint, int, pte_t *);
+int             update_ref_count(uint, int, pte_t *);
 uint            get_count_ref(uint);
 
 // kbd.c
 void            kbdintr(void);
 
+// ksm.c
+void            ksminit(void);
+void            ksmd(void);
+int             ksmctl(int, int);
+void            ksmstat(struct vmstat*);
+
+// zswap.c
+void            zswapinit(void);
+int             zswap_store(char*, struct swap_slot*);
+void            zswap_load(char*, struct swap_slot*);
+void            zswap_free(struct swap_slot*);
+int             zswap_grow(char*);
+void            zswapstat(struct vmstat*);
+
 // lapic.c
 void            cmostime(struct rtcdate *r);
 int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
+void            lapicipi(uchar, int);
 void            lapicinit(void);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
@@ -103,6 +152,13 @@ void            mpinit(void);
 void            picenable(int);
 void            picinit(void);
 
+// pagecache.c
+void            pcacheinit(void);
+int             pcache_map(struct inode*, uint, uint, pte_t*);
+void            pcache_invalidate(struct inode*);
+int             pcache_shrink(void);
+void            pcachestat(struct vmstat*);
+
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
@@ -128,8 +184,13 @@ void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
 void            yield(void);
+struct proc*    kthread_create(char*, void(*)(void));
+int             spawn(char*, char**, struct file**);
 void            print_rss(void);
 struct proc*    find_victim_proc(void);
+void            rss_add(struct proc*, int);
+void            rss_set(struct proc*, uint);
+void            rss_pte(pte_t*, int);
 pte_t*          find_victim_page(struct proc* v_proc);
 
 // swtch.S
@@ -161,7 +222,7 @@ char*           strncpy(char*, const char*, int);
 
 // syscall.c
 int             argint(int, int*);
-int             argptr(int, char**, int);
+int             argptr(int, char**, int, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -187,6 +248,9 @@ void            kvmalloc(void);
 pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
+int             allocuvm_p(pde_t*, uint, uint, struct proc*);
+int             allocuvm_zero(pde_t*, uint, uint);
+int             iszeropage(uint);
 int             deallocuvm(pde_t*, uint, uint);
 int             deallocuvm_p(pde_t*, uint, uint, struct proc*);
 void            freevm(pde_t*);
@@ -198,19 +262,34 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
-void            pagefault_handler();
+int             pagefault_handler(void);
+int             uvmfault(uint);
+int             uvmprefault(uint, uint, int);
+void            vmfaultstat(struct vmstat*);
+void            vmacopy(struct vma*, struct vma*);
+void            vmaclear(struct vma*);
+void            tlb_flush_page(pde_t*, uint);
+void            tlb_flush_range(pde_t*, uint, uint);
+void            tlb_flush_all(pde_t*);
+void            tlbqinit(void);
+void            tlb_shootdown_intr(void);
+uint            tlb_shootdown_pte(pte_t*);
+void            tlb_shootdown_sync(uint);
 void clear_iterate(struct proc*);
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
 
 void            swap_in(pte_t *);
+int             swap_dup(pte_t*, pte_t*);
 void            swapinit(int dev);
-void            clean_all_slots(pte_t *pte);
-void            page_swap_out(pte_t *pte, struct proc* p);
-void            write_page_to_disk(char*, struct swap_slot *);
-// void            write_page_to_disk(pte_t *pte, struct swap_slot *swap_slot);
-struct swap_slot*  swap_get_free_slot();
-void            page_fault_handler(void);
+int             swap_drop(pte_t*);
+void            swapcache_free(uint);
+int             swap_alloc_run(int);
+void            page_fault_handler(uint);
 void            update_rss(struct proc* p);
-void            swap_free(struct proc* p);
+int             swap_reclaim(void);
+void            reclaim_lock(void);
+void            reclaim_unlock(void);
+int             swap_setpolicy(int);
+void            swapstat(struct vmstat*);
 
@@ -7,18 +7,24 @@
 #include "x86.h"
 #include "elf.h"
 
+// Load the program at path into a new address space, with argv set up
+// on its stack. Shared by exec() and spawn(). On success returns 0 and
+// the new page table, its size and the initial eip and esp. The program
+// segments are not read here: they become file mappings in vma (NVMA of
+// them) and are paged in on first touch. The pages mapped now are
+// charged to p, the process that will run the program.
 int
-exec(char *path, char **argv)
+execload(char *path, char **argv, pde_t **pgdirp, uint *szp, uint *eipp, uint *espp,
+         struct vma *vma, struct proc *p)
 {
-  char *s, *last;
-  int i, off;
+  int i, off, nvma;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
+  pde_t *pgdir;
 
+  memset(vma, 0, NVMA*sizeof(vma[0]));
   begin_op();
 
   if((ip = namei(path)) == 0){
@@ -40,6 +46,7 @@ exec(char *path, char **argv)
 
   // Load program into memory.
   sz = 0;
+  nvma = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -49,10 +56,25 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
-      goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
+    if(nvma < NVMA){
+      if(ph.vaddr + ph.memsz >= KERNBASE)
+        goto bad;
+      vma[nvma].start = ph.vaddr;
+      vma[nvma].end = ph.vaddr + ph.memsz;
+      vma[nvma].ip = idup(ip);
+      iexecmap(ip, 1);
+      vma[nvma].off = ph.off;
+      vma[nvma].filesz = ph.filesz;
+      nvma++;
+      if(ph.vaddr + ph.memsz > sz)
+        sz = ph.vaddr + ph.memsz;
+      continue;
+    }
+    // Out of mappings: load the rest the old way.
+    if((sz = allocuvm_p(pgdir, sz, ph.vaddr + ph.memsz, p)) == 0)
+      goto bad;
     if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
       goto bad;
   }
@@ -63,7 +85,7 @@ exec(char *path, char **argv)
   // Allocate two pages at the next page boundary.
   // Make the first inaccessible.  Use the second as the user stack.
   sz = PGROUNDUP(sz);
-  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+  if((sz = allocuvm_p(pgdir, sz, sz + 2*PGSIZE, p)) == 0)
     goto bad;
   clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
   sp = sz;
@@ -87,28 +109,62 @@ exec(char *path, char **argv)
   if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
     goto bad;
 
-  // Save program name for debugging.
+  *pgdirp = pgdir;
+  *szp = sz;
+  *eipp = elf.entry;  // main
+  *espp = sp;
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm_p(pgdir, p);
+  if(ip){
+    iunlockput(ip);
+    end_op();
+  }
+  begin_op();
+  vmaclear(vma);
+  end_op();
+  return -1;
+}
+
+// The last component of path, for naming a process.
+char*
+execname(char *path)
+{
+  char *s, *last;
+
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
+  return last;
+}
+
+int
+exec(char *path, char **argv)
+{
+  uint sz, eip, esp;
+  pde_t *pgdir, *oldpgdir;
+  struct vma vma[NVMA];
+  struct proc *curproc = myproc();
+
+  if(execload(path, argv, &pgdir, &sz, &eip, &esp, vma, curproc) < 0)
+    return -1;
+
+  // Save program name for debugging.
+  safestrcpy(curproc->name, execname(path), sizeof(curproc->name));
 
   // Commit to the user image.
   oldpgdir = curproc->pgdir;
   curproc->pgdir = pgdir;
   curproc->sz = sz;
-  curproc->tf->eip = elf.entry;  // main
-  curproc->tf->esp = sp;
+  curproc->tf->eip = eip;
+  curproc->tf->esp = esp;
+  begin_op();
+  vmaclear(curproc->vma);
+  end_op();
+  memmove(curproc->vma, vma, sizeof(vma));
   switchuvm(curproc);
   freevm(oldpgdir);
   return 0;
-
- bad:
-  if(pgdir)
-    freevm(pgdir);
-  if(ip){
-    iunlockput(ip);
-    end_op();
-  }
-  return -1;
 }
@@ -282,6 +282,17 @@ idup(struct inode *ip)
   return ip;
 }
 
+// Count a program mapping of ip's contents (delta 1) or drop one.
+// Mapped pages are read from the file as they are first touched, so
+// writei() refuses to change the file while any remain.
+void
+iexecmap(struct inode *ip, int delta)
+{
+  acquire(&icache.lock);
+  ip->nexec += delta;
+  release(&icache.lock);
+}
+
 // Lock the given inode.
 // Reads the inode from disk if necessary.
 void
@@ -411,6 +422,7 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  pcache_invalidate(ip);
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -494,6 +506,14 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  // A running program maps this file: don't let it see a mix of old
+  // and new pages (ETXTBSY).
+  acquire(&icache.lock);
+  m = ip->nexec;
+  release(&icache.lock);
+  if(m > 0)
+    return -1;
+  pcache_invalidate(ip);
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
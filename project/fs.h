@@ -73,4 +73,7 @@ struct swap_slot
   int dev_id;
   int proc_id;
   pte_t* swapmap[NPROC];
+  char *zdata;    // compressed copy in the zswap pool, or 0 if on disk
+  int zlen;       // its length in bytes
+  int busy;       // being read or written; faults on the slot wait
 };
\ No newline at end of file
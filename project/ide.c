@@ -24,6 +24,8 @@
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
 
+#define IDE_MAXSECT   16  // sectors moved per interrupt by RDMUL/WRMUL
+
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
 // You must hold idelock while manipulating queue.
@@ -34,6 +36,41 @@ static struct buf *idequeue;
 static int havedisk1;
 static void idestart(struct buf*);
 
+// A request made outside the buffer cache moves nblocks blocks to or
+// from a list of pages; others move the one block in b->data.
+static int
+bufsect(struct buf *b)
+{
+  return (b->pages ? b->nblocks : 1) * (BSIZE / SECTOR_SIZE);
+}
+
+static uchar*
+sectaddr(struct buf *b, int s)
+{
+  uint off = s * SECTOR_SIZE;
+
+  if(b->pages == 0)
+    return b->data + off;
+  return b->pages[off / PGSIZE] + off % PGSIZE;
+}
+
+// Move b's next batch of sectors between memory and the drive. Multiple
+// sector commands transfer up to IDE_MAXSECT sectors per interrupt.
+static void
+idepio(struct buf *b)
+{
+  int n = bufsect(b) - b->xfer;
+
+  if(n > IDE_MAXSECT)
+    n = IDE_MAXSECT;
+  for(; n > 0; n--, b->xfer++){
+    if(b->flags & B_DIRTY)
+      outsl(0x1f0, sectaddr(b, b->xfer), SECTOR_SIZE/4);
+    else
+      insl(0x1f0, sectaddr(b, b->xfer), SECTOR_SIZE/4);
+  }
+}
+
 // Wait for IDE disk to become ready.
 static int
 idewait(int checkerr)
@@ -75,25 +112,27 @@ idestart(struct buf *b)
 {
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int nsect = bufsect(b);
+  int read_cmd = (nsect == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (nsect == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  if(b->blockno + nsect / sector_per_block > FSSIZE)
+    panic("incorrect blockno");
+  if (sector_per_block > 7 || nsect > 255) panic("idestart");
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsect);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+  b->xfer = 0;
   if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    idepio(b);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -112,11 +151,25 @@ ideintr(void)
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  // Read data if needed, or send the next batch of a long write. The
+  // drive interrupts again when it is ready for more.
+  if(!(b->flags & B_DIRTY)){
+    if(idewait(1) >= 0)
+      idepio(b);
+    else
+      b->xfer = bufsect(b);
+  } else if(b->xfer < bufsect(b)){
+    idewait(0);
+    idepio(b);
+    release(&idelock);
+    return;
+  }
+  if(b->xfer < bufsect(b)){
+    release(&idelock);
+    return;
+  }
+  idequeue = b->qnext;
 
   // Wake process waiting for this buf.
   b->flags |= B_VALID;
@@ -1,13 +1,16 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, or physically
+// contiguous blocks of 2^order pages through kalloc_order().
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "x86.h"
 #include "spinlock.h"
+#include "vmstat.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -15,15 +18,96 @@ extern char end[]; // first address after kernel loaded from ELF file
 
 struct run {
   struct run *next;
+  struct run *prev;  // only used on the buddy lists
 };
 
+// Reverse map. Most frames are mapped by exactly one PTE, so that PTE is
+// kept inline in the frame's struct page. Further sharers (COW after fork)
+// go on an overflow chain of rmap nodes, which are carved out of whole
+// pages on demand and never handed back. Overflow nodes are also hashed
+// by PTE address so that removing a mapping does not walk the chain.
+struct rmap_node {
+  pte_t *pte;
+  struct page *pg;           // frame the PTE maps
+  struct rmap_node *next;    // next mapper of the same frame
+  struct rmap_node **pprev;  // link that points at us
+  struct rmap_node *hnext;   // next node in the same hash bucket
+  struct rmap_node **hpprev; // hash link that points at us
+};
+
+#define RMAP_PER_PAGE (PGSIZE / sizeof(struct rmap_node))
+#define RMAP_LOWAT    32  // refill the node pool below this many free nodes
+#define RMAP_HASHBITS 10
+#define RMAP_HASH(pte) (((uint)(pte) * 2654435761U) >> (32 - RMAP_HASHBITS))
+
+struct page {
+  int refcnt;               // PTEs mapping this frame, plus kref_get() holds
+  pte_t *pte;               // first mapper (inline rmap slot)
+  struct rmap_node *chain;  // remaining mappers
+  uchar order;              // order of the free block this page heads
+  uchar flags;
+  ushort pdx;               // for a page-table page: the PDX it maps
+  uchar ptref;              // page directories sharing it; 0 if never shared
+};
+
+#define PG_BUDDY 0x1  // heads a free block on a buddy list
+#define PG_PINNED 0x2 // held by the page cache; not freed or swapped
+
+// Free memory is kept by a binary buddy allocator: free_area[k] lists
+// the free blocks of 2^k pages, each aligned to its own size. Freeing a
+// block merges it with its buddy for as long as the buddy is free too.
+#define MAXORDER (NORDER - 1)
+#define NPAGE    (PHYSTOP >> PTXSHIFT)
+
+// Per-CPU magazine of free pages. kalloc() and kfree() work out of the
+// local magazine and only take kmem.lock to move a batch of pages to or
+// from the buddy allocator.
+#define KMAG_BATCH 8   // pages moved between a magazine and the buddy lists
+#define KMAG_MAX   16  // drain a batch back once a magazine holds this many
+
+struct kmag {
+  struct spinlock lock;
+  int n;               // pages in list; counted as free
+  struct run *list;
+};
+
+// Pool of pages that are already zero, so that page-table and user
+// page allocations need not clear them on the faulting CPU. The kzerod
+// kernel thread tops it up while CPUs are idle. Pooled pages still
+// count as free, and kalloc() falls back to them when all else is gone.
+#define KZERO_TARGET  64  // pages kzerod tries to keep in the pool
+#define KZERO_BATCH   8   // pages zeroed per wakeup
+#define KZERO_RESERVE 32  // leave at least this many unzeroed free pages
+
+// The kswapd kernel thread swaps pages out in the background once free
+// memory drops below KSWAPD_LOW, until KSWAPD_HIGH pages are free, so
+// that allocations seldom have to reclaim (and wait for the disk)
+// themselves.
+#define KSWAPD_LOW    16
+#define KSWAPD_HIGH   48
+
 struct {
   struct spinlock lock;
   int use_lock;
   uint num_free_pages;  //store number of free pages
-  struct run *freelist;
-  int rmap[PHYSTOP >> PTXSHIFT]; //store the reference count of each page
-  pte_t* rmap_2D[PHYSTOP >> PTXSHIFT][NPROC]; //store the reference count of each page for each process
+  struct run *free_area[NORDER];
+  uint nfree_area[NORDER];   // free blocks of each order
+  struct kmag mag[NCPU];
+  struct spinlock rmaplock;  // protects pages[] and the rmap node pool
+  struct page pages[NPAGE]; //refcount and rmap of each page
+  struct rmap_node *rmap_free;  // free overflow nodes
+  struct rmap_node *rmap_hash[1 << RMAP_HASHBITS];
+  uint rmap_nfree;
+  uint rmap_reserved;           // free nodes set aside by rmap_reserve()
+  uint rmap_pages;              // pages given to the node pool
+  struct spinlock zlock;        // protects the zero pool
+  struct run *zlist;
+  uint nzero;                   // pages in zlist; counted as free
+  uint zhits;                   // kalloc_zeroed() served from the pool
+  uint zmisses;                 // kalloc_zeroed() had to clear a page
+  uint kswapd_wakeups;          // times kswapd found memory low
+  uint kswapd_pages;            // pages it swapped out
+  uint direct_reclaims;         // pages kalloc() had to swap out itself
 } kmem;
 
 // Small function to obtain the pointer to reference count of a page given virtual address v [we'll return pointer so that we can increment/decrement the reference count easily]
@@ -31,7 +115,7 @@ struct {
 //! Use this function wisely -> only when the caller function acquires lock before calling this function
 int* get_ref_count_without_locks(char* v)
 {
-  return &kmem.rmap[V2P(v) >> PTXSHIFT];
+  return &kmem.pages[V2P(v) >> PTXSHIFT].refcnt;
 }
 
 
@@ -44,6 +128,10 @@ void
 kinit1(void *vstart, void *vend)
 {
   initlock(&kmem.lock, "kmem");
+  initlock(&kmem.rmaplock, "rmap");
+  initlock(&kmem.zlock, "kzero");
+  for(int i = 0; i < NCPU; i++)
+    initlock(&kmem.mag[i].lock, "kmag");
   kmem.use_lock = 0;
   kmem.num_free_pages = 0;
   freerange(vstart, vend);
@@ -64,14 +152,123 @@ freerange(void *vstart, void *vend)
   for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
   {
     // kmem.num_free_pages+=1;
-    kmem.rmap[V2P(p) >> PTXSHIFT] = 0; //initialize the reference count of each page to 0
-    for(int p_id=0;p_id<NPROC;++p_id){
-      kmem.rmap_2D[V2P(p) >> PTXSHIFT][p_id] = 0;
-    }  
-      kfree(p);
+    kmem.pages[V2P(p) >> PTXSHIFT].refcnt = 0; //initialize the reference count of each page to 0
+    kmem.pages[V2P(p) >> PTXSHIFT].pte = 0;
+    kmem.pages[V2P(p) >> PTXSHIFT].chain = 0;
+    kmem.pages[V2P(p) >> PTXSHIFT].flags = 0;
+    kfree(p);
   }
     
 }
+
+// Put the block of 2^order pages at pfn on its free list.
+// Must hold kmem.lock.
+static void
+buddy_link(uint pfn, int order)
+{
+  struct run *r = (struct run*)P2V(pfn << PTXSHIFT);
+
+  kmem.pages[pfn].order = order;
+  kmem.pages[pfn].flags |= PG_BUDDY;
+  r->prev = 0;
+  r->next = kmem.free_area[order];
+  if(r->next)
+    r->next->prev = r;
+  kmem.free_area[order] = r;
+  kmem.nfree_area[order] += 1;
+  kmem.num_free_pages += 1 << order;
+}
+
+// Take the free block at pfn off its free list. Must hold kmem.lock.
+static void
+buddy_unlink(uint pfn)
+{
+  struct run *r = (struct run*)P2V(pfn << PTXSHIFT);
+  int order = kmem.pages[pfn].order;
+
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.free_area[order] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  kmem.pages[pfn].flags &= ~PG_BUDDY;
+  kmem.nfree_area[order] -= 1;
+  kmem.num_free_pages -= 1 << order;
+}
+
+// Free the block of 2^order pages at pfn, merging it with its buddy
+// as far up as possible. Must hold kmem.lock.
+static void
+buddy_free(uint pfn, int order)
+{
+  uint buddy;
+
+  for(; order < MAXORDER; order++){
+    buddy = pfn ^ (1 << order);
+    if(buddy >= NPAGE || !(kmem.pages[buddy].flags & PG_BUDDY) ||
+       kmem.pages[buddy].order != order)
+      break;
+    buddy_unlink(buddy);
+    pfn &= ~(1 << order);
+  }
+  buddy_link(pfn, order);
+}
+
+// Allocate a block of 2^order pages, splitting a larger block if
+// needed. Returns 0 if none is free. Must hold kmem.lock.
+static struct run*
+buddy_alloc(int order)
+{
+  uint pfn;
+  int k;
+
+  for(k = order; k <= MAXORDER && kmem.free_area[k] == 0; k++)
+    ;
+  if(k > MAXORDER)
+    return 0;
+  pfn = V2P(kmem.free_area[k]) >> PTXSHIFT;
+  buddy_unlink(pfn);
+  // Hand the unused upper halves back.
+  while(k > order){
+    k--;
+    buddy_link(pfn + (1 << k), k);
+  }
+  return (struct run*)P2V(pfn << PTXSHIFT);
+}
+
+// Move up to n pages from the buddy allocator into magazine m.
+// Must hold m->lock.
+static void
+kmag_refill(struct kmag *m, int n)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  for(; n > 0 && (r = buddy_alloc(0)) != 0; n--){
+    r->next = m->list;
+    m->list = r;
+    m->n += 1;
+  }
+  release(&kmem.lock);
+}
+
+// Move up to n pages from magazine m back to the buddy allocator.
+// Must hold m->lock.
+static void
+kmag_drain(struct kmag *m, int n)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  for(; n > 0 && (r = m->list) != 0; n--){
+    m->list = r->next;
+    m->n -= 1;
+    buddy_free(V2P(r) >> PTXSHIFT, 0);
+  }
+  release(&kmem.lock);
+}
+
 //PAGEBREAK: 21
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
@@ -81,25 +278,90 @@ void
 kfree(char *v)
 {
   struct run *r;
+  struct kmag *m;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-
   // Now depending on the value of ref_count, we can decide whether to free the page or not (if ref_count > 0, then don't free the page, just decrement)
-  int* ref_count = get_ref_count_without_locks(v); // Notice how we are not applying any locks here since lock has been applied before calling this function
-  if (*ref_count == 0){ //if ref_count == 0, then free the page and add it to the free list //just to be sure
-    memset(v, 1, PGSIZE); // Fill with junk to catch dangling refs.
-    r = (struct run*)v;
-    r->next = kmem.freelist;
-    kmem.num_free_pages+=1;
-    kmem.freelist = r;
+  // The caller has already dropped its mapping, so nobody else can be
+  // raising the count; reading it without kmem.rmaplock is fine.
+  int* ref_count = get_ref_count_without_locks(v);
+  if (*ref_count != 0 || (kmem.pages[V2P(v) >> PTXSHIFT].flags & PG_PINNED))
+    return;
+  swapcache_free(V2P(v));
+
+#ifdef KALLOC_DEBUG
+  memset(v, 1, PGSIZE); // Fill with junk to catch dangling refs.
+#endif
+  r = (struct run*)v;
+
+  if(!kmem.use_lock){
+    // Still booting on one CPU; cpuid() is not usable yet.
+    buddy_free(V2P(v) >> PTXSHIFT, 0);
+    return;
   }
 
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  pushcli();
+  m = &kmem.mag[cpuid()];
+  acquire(&m->lock);
+  r->next = m->list;
+  m->list = r;
+  m->n += 1;
+  if(m->n >= KMAG_MAX)
+    kmag_drain(m, KMAG_BATCH);
+  release(&m->lock);
+  popcli();
+}
+
+// Take a free page without reclaiming: from this CPU's magazine
+// (refilled from the buddy lists in a batch), or failing that from
+// another CPU's magazine. Returns 0 if there are no free pages.
+static struct run*
+kalloc_free(void)
+{
+  struct run *r;
+  struct kmag *m;
+  int i;
+
+  if(!kmem.use_lock)
+    return buddy_alloc(0);
+
+  pushcli();
+  m = &kmem.mag[cpuid()];
+  acquire(&m->lock);
+  if(m->list == 0)
+    kmag_refill(m, KMAG_BATCH);
+  if((r = m->list) != 0){
+    m->list = r->next;
+    m->n -= 1;
+  }
+  release(&m->lock);
+  popcli();
+  if(r)
+    return r;
+
+  // The buddy lists are empty; pages may still sit in other magazines.
+  for(i = 0; i < NCPU && r == 0; i++){
+    m = &kmem.mag[i];
+    acquire(&m->lock);
+    if((r = m->list) != 0){
+      m->list = r->next;
+      m->n -= 1;
+    }
+    release(&m->lock);
+  }
+  if(r)
+    return r;
+
+  // Last resort before reclaim: give up a pre-zeroed page.
+  acquire(&kmem.zlock);
+  if((r = kmem.zlist) != 0){
+    kmem.zlist = r->next;
+    kmem.nzero -= 1;
+  }
+  release(&kmem.zlock);
+  return r;
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -108,89 +370,735 @@ kfree(char *v)
 char*
 kalloc(void)
 {
-  cprintf("kalloc: num_free_pages = %d\n", kmem.num_free_pages);
   struct run *r;
+  int n;
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-  {
-    kmem.freelist = r->next;
-    kmem.num_free_pages-=1;
+  if((r = kalloc_free()) != 0)
+    return (char*)r;
+  if(pcache_shrink() > 0)
+    return kalloc();
+  // kswapd has fallen behind: reclaim on the caller's time.
+  if((n = swap_reclaim()) < 0){
+    cprintf("kalloc: out of memory\n");
+    return 0;
   }
-  if(kmem.use_lock)
-    release(&kmem.lock);
-  if (r){
-    cprintf("kalloc returning after first time:%x\n", r);
+  kmem.direct_reclaims += n;
+  return kalloc();
+}
+
+// Allocate one page of zeroed memory. Takes it from the zero pool
+// when possible and otherwise clears a page from kalloc().
+char*
+kalloc_zeroed(void)
+{
+  struct run *r;
+  char *v;
+
+  acquire(&kmem.zlock);
+  if((r = kmem.zlist) != 0){
+    kmem.zlist = r->next;
+    kmem.nzero -= 1;
+    kmem.zhits += 1;
+  } else
+    kmem.zmisses += 1;
+  release(&kmem.zlock);
+  if(r){
+    r->next = 0;  // the only word kzerod left non-zero
     return (char*)r;
   }
-  struct proc* victim = find_victim_proc();
-  if(victim == 0)
-    cprintf("No victim proc found\n");
-  pte_t* pte = find_victim_page(victim);
-  page_swap_out(pte,victim);
-  char* v = kalloc();
-  cprintf("kalloc returning after second time: %x\n", v);
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
   return v;
 }
 
+// Called by an idle scheduler() (without ptable.lock) to get kzerod
+// going when the pool is low and there are free pages to spare.
+void
+kzero_idle(void)
+{
+  // Unlocked reads: a stale value only delays or repeats a wakeup.
+  if(kmem.nzero < KZERO_TARGET && kmem.num_free_pages > KZERO_RESERVE)
+    wakeup(&kmem.zlist);
+}
+
+// Kernel thread that refills the zero pool. It zeroes a batch of pages
+// each time an idle CPU wakes it and goes back to sleep, so it only runs
+// when nothing else wants the CPU.
+void
+kzerod(void)
+{
+  struct run *r;
+  int n;
+
+  for(;;){
+    acquire(&kmem.zlock);
+    sleep(&kmem.zlist, &kmem.zlock);
+    release(&kmem.zlock);
+    for(n = 0; n < KZERO_BATCH && kmem.nzero < KZERO_TARGET; n++){
+      if(kmem.num_free_pages <= KZERO_RESERVE || (r = kalloc_free()) == 0)
+        break;
+      memset(r, 0, PGSIZE);
+      acquire(&kmem.zlock);
+      r->next = kmem.zlist;
+      kmem.zlist = r;
+      kmem.nzero += 1;
+      release(&kmem.zlock);
+    }
+  }
+}
+
+// Free pages, not counting those in the per-CPU magazines. Read
+// without locks: good enough for a watermark.
+static uint
+kfree_estimate(void)
+{
+  return kmem.num_free_pages + kmem.nzero;
+}
+
+// Background reclaim. Wakes every tick to check the watermark rather
+// than being woken by kalloc(), which may run with ptable.lock held.
+void
+kswapd(void)
+{
+  int n;
+
+  for(;;){
+    acquire(&tickslock);
+    while(kfree_estimate() >= KSWAPD_LOW)
+      sleep(&ticks, &tickslock);
+    release(&tickslock);
+    kmem.kswapd_wakeups += 1;
+    while(num_of_FreePages() < KSWAPD_HIGH && (n = swap_reclaim()) > 0)
+      kmem.kswapd_pages += n;
+  }
+}
+
+// Allocate a physically contiguous block of 2^order pages, aligned to
+// its size. Order 0 is a plain kalloc(). Larger blocks never trigger
+// reclaim (swapping out single pages rarely frees a whole block), so
+// this returns 0 if no block of the order is free.
+char*
+kalloc_order(int order)
+{
+  struct run *r;
+
+  if(order < 0 || order > MAXORDER)
+    panic("kalloc_order");
+  if(order == 0)
+    return kalloc();
+  acquire(&kmem.lock);
+  r = buddy_alloc(order);
+  release(&kmem.lock);
+  return (char*)r;
+}
+
+// Free a block returned by kalloc_order(). None of its pages may
+// still be referenced.
+void
+kfree_order(char *v, int order)
+{
+  uint pfn;
+  int i;
+
+  if(order < 0 || order > MAXORDER)
+    panic("kfree_order");
+  if(order == 0){
+    kfree(v);
+    return;
+  }
+  pfn = V2P(v) >> PTXSHIFT;
+  if((uint)v % (PGSIZE << order) || v < end || pfn + (1 << order) > NPAGE)
+    panic("kfree_order");
+  for(i = 0; i < (1 << order); i++)
+    if(kmem.pages[pfn + i].refcnt != 0)
+      panic("kfree_order: page in use");
+#ifdef KALLOC_DEBUG
+  memset(v, 1, PGSIZE << order); // Fill with junk to catch dangling refs.
+#endif
+  acquire(&kmem.lock);
+  buddy_free(pfn, order);
+  release(&kmem.lock);
+}
+
 uint 
 num_of_FreePages(void)
 {
-  acquire(&kmem.lock);
+  uint num_free_pages;
+  int i;
 
-  uint num_free_pages = kmem.num_free_pages;
-  
+  acquire(&kmem.lock);
+  num_free_pages = kmem.num_free_pages;
   release(&kmem.lock);
-  
+
+  // Pages cached in the per-CPU magazines are free too.
+  for(i = 0; i < NCPU; i++){
+    acquire(&kmem.mag[i].lock);
+    num_free_pages += kmem.mag[i].n;
+    release(&kmem.mag[i].lock);
+  }
+  // So are the pages waiting in the zero pool.
+  acquire(&kmem.zlock);
+  num_free_pages += kmem.nzero;
+  release(&kmem.zlock);
   return num_free_pages;
 }
 
 // The following functions will be called in vm.c's pagefault handler to increment/decrement the reference count of the page
 // So these functions will first acquire locks and then operate (since we are not going to be calling lock in the pagefault handler)
 
+// Give the free page r to the rmap node pool. Must hold kmem.rmaplock.
+static void
+rmap_addpage(struct run *r)
+{
+  struct rmap_node *n;
+
+  kmem.rmap_pages += 1;
+  for(n = (struct rmap_node*)r; n < (struct rmap_node*)r + RMAP_PER_PAGE; n++){
+    n->next = kmem.rmap_free;
+    kmem.rmap_free = n;
+  }
+  kmem.rmap_nfree += RMAP_PER_PAGE;
+}
+
+// Top up the rmap node pool with a free page. Must hold kmem.rmaplock.
+// This never reclaims: we may be in the middle of mapping a frame that
+// reclaim could pick as its victim. If memory is that tight we live off
+// the slack left by RMAP_LOWAT and try again on the next insert.
+static void
+rmap_refill(void)
+{
+  struct run *r;
+
+  if(kmem.rmap_nfree - kmem.rmap_reserved >= RMAP_LOWAT ||
+     (r = kalloc_free()) == 0)
+    return;
+  rmap_addpage(r);
+}
+
+// Set aside nodes for n mappers that the caller is about to add and
+// cannot back out of, such as every PTE sharing a swap slot. Each mapper
+// added with reserved set uses up one, whether it needs a node or not.
+// May reclaim to get more, so hold no locks. Returns -1 if out of memory.
+int
+rmap_reserve(int n)
+{
+  char *mem;
+
+  acquire(&kmem.rmaplock);
+  while(kmem.rmap_nfree < kmem.rmap_reserved + n){
+    release(&kmem.rmaplock);
+    if((mem = kalloc()) == 0)
+      return -1;
+    acquire(&kmem.rmaplock);
+    rmap_addpage((struct run*)mem);
+  }
+  kmem.rmap_reserved += n;
+  release(&kmem.rmaplock);
+  return 0;
+}
+
+// Give back n reserved nodes that were not used.
+void
+rmap_unreserve(int n)
+{
+  acquire(&kmem.rmaplock);
+  kmem.rmap_reserved -= n;
+  release(&kmem.rmaplock);
+}
+
+// Add pte as a mapper of page pg, using a node set aside by
+// rmap_reserve() if reserved is set. Returns -1 if no node is left.
+// Must hold kmem.rmaplock.
+static int
+rmap_add(struct page *pg, pte_t *pte, int reserved)
+{
+  struct rmap_node *n, **h;
+
+  if(reserved){
+    if(kmem.rmap_reserved == 0)
+      panic("rmap_add: not reserved");
+    kmem.rmap_reserved -= 1;
+  }
+  if(pg->pte == 0){
+    pg->pte = pte;
+    return 0;
+  }
+  if(!reserved){
+    rmap_refill();
+    if(kmem.rmap_nfree <= kmem.rmap_reserved)
+      return -1;
+  }
+  n = kmem.rmap_free;
+  kmem.rmap_free = n->next;
+  kmem.rmap_nfree -= 1;
+  n->pte = pte;
+  n->pg = pg;
+  n->next = pg->chain;
+  if(pg->chain)
+    pg->chain->pprev = &n->next;
+  n->pprev = &pg->chain;
+  pg->chain = n;
+  h = &kmem.rmap_hash[RMAP_HASH(pte)];
+  n->hnext = *h;
+  if(*h)
+    (*h)->hpprev = &n->hnext;
+  n->hpprev = h;
+  *h = n;
+  return 0;
+}
+
+// Unlink overflow node n from its frame's chain and from the hash,
+// and put it back on the free list. Must hold kmem.rmaplock.
+static void
+rmap_free_node(struct rmap_node *n)
+{
+  *n->pprev = n->next;
+  if(n->next)
+    n->next->pprev = n->pprev;
+  *n->hpprev = n->hnext;
+  if(n->hnext)
+    n->hnext->hpprev = n->hpprev;
+  n->next = kmem.rmap_free;
+  kmem.rmap_free = n;
+  kmem.rmap_nfree += 1;
+}
+
+// Remove pte from the mappers of page pg. Must hold kmem.rmaplock.
+// Constant time: either pte is the inline mapper, or its node is
+// found through the hash and unlinked via its back-pointer.
+static void
+rmap_remove(struct page *pg, pte_t *pte)
+{
+  struct rmap_node *n;
+
+  if(pg->pte == pte){
+    // Promote an overflow node into the inline slot.
+    if((n = pg->chain) == 0){
+      pg->pte = 0;
+      return;
+    }
+    pg->pte = n->pte;
+  } else {
+    // The same PTE may be on the hash for another frame too, if it was
+    // repointed before that frame's mapping was dropped.
+    for(n = kmem.rmap_hash[RMAP_HASH(pte)]; n && (n->pte != pte || n->pg != pg);
+        n = n->hnext)
+      ;
+    if(n == 0)
+      return;
+  }
+  rmap_free_node(n);
+}
+
+// Is pte a present mapping of pa, on pg's list of mappers? Must hold
+// kmem.rmaplock.
+static int
+rmap_maps(struct page *pg, uint pa, pte_t *pte)
+{
+  struct rmap_node *n;
+
+  if(!(*pte & PTE_P) || PTE_ADDR(*pte) != pa)
+    return 0;
+  if(pg->pte == pte)
+    return 1;
+  for(n = pg->chain; n; n = n->next)
+    if(n->pte == pte)
+      return 1;
+  return 0;
+}
+
 // function to update ref_count of a page
-void update_ref_count(uint pa, int increment, pte_t * pt_entry) // increment = 1 if we want to increment the ref_count, increment = -1 if we want to decrement the ref_count
+// Returns -1, changing nothing, if there is no rmap node for a new mapper.
+int update_ref_count(uint pa, int increment, pte_t * pt_entry) // increment = 1 if we want to increment the ref_count, increment = -1 if we want to decrement the ref_count
 {
   // sanity check for bounds of pa
   if (pa >= PHYSTOP || pa < (uint) V2P(end))
     panic("update_ref_count: pa out of bounds");
   
-  acquire(&kmem.lock);
-  char* v = P2V(pa);
-  int* ref_count = get_ref_count_without_locks(v); // Notice how we are not applying any locks here since lock has been applied before calling this function
+  acquire(&kmem.rmaplock);
+  struct page *pg = &kmem.pages[pa >> PTXSHIFT];
   if (increment == 1){
-    kmem.rmap_2D[pa >> PTXSHIFT][kmem.rmap[pa >> PTXSHIFT]] = pt_entry;
-    *ref_count += increment;
+    if (rmap_add(pg, pt_entry, 0) < 0){
+      release(&kmem.rmaplock);
+      return -1;
+    }
+    pg->refcnt += increment;
   }
   else if (increment == -1){
-    int index = NPROC;
-    for(int j=0;j<NPROC;++j){
-    if(kmem.rmap_2D[pa >> PTXSHIFT][j] == pt_entry){
-      index = j;
-      kmem.rmap_2D[pa >> PTXSHIFT][j] = 0;
-      break;
+    rmap_remove(pg, pt_entry);
+    pg->refcnt += increment;
+  }
+  else
+    panic("update_ref_count: increment should be either 1 or -1");
+  release(&kmem.rmaplock);
+  return 0;
+}
+
+// Set pte to val, which maps pa, and add it to pa's mappers with a node
+// set aside by rmap_reserve().
+void
+rmap_map(uint pa, pte_t *pte, pte_t val)
+{
+  struct page *pg = &kmem.pages[pa >> PTXSHIFT];
+
+  acquire(&kmem.rmaplock);
+  *pte = val;
+  rmap_add(pg, pte, 1);
+  pg->refcnt += 1;
+  release(&kmem.rmaplock);
+}
+
+// Record that page-table page pgtab maps directory slot pdx, so that
+// pte2va() can tell which virtual address a PTE in it translates.
+void
+pgtab_setpdx(char *pgtab, uint pdx)
+{
+  kmem.pages[V2P(pgtab) >> PTXSHIFT].pdx = pdx;
+}
+
+// The virtual address translated by the PTE at pte.
+uint
+pte2va(pte_t *pte)
+{
+  uint pdx = kmem.pages[V2P(pte) >> PTXSHIFT].pdx;
+  return (uint)PGADDR(pdx, ((uint)pte % PGSIZE) / sizeof(pte_t), 0);
+}
+
+// Hold a reference to the user page at pa, which pte maps, so that it
+// is not freed while the caller copies it even if reclaim unmaps it.
+// Returns -1 if pte no longer maps pa.
+int
+kref_get(uint pa, pte_t *pte)
+{
+  struct page *pg = &kmem.pages[pa >> PTXSHIFT];
+  int r = -1;
+
+  acquire(&kmem.rmaplock);
+  if(rmap_maps(pg, pa, pte)){
+    pg->refcnt += 1;
+    r = 0;
+  }
+  release(&kmem.rmaplock);
+  return r;
+}
+
+// Drop a reference to pg. Returns the references left, counting a pin
+// as one: whoever sees 0 frees the frame, and for a pinned frame that is
+// left to kunpin(). Must hold kmem.rmaplock.
+static int
+kref_dec(struct page *pg)
+{
+  pg->refcnt -= 1;
+  return pg->refcnt + ((pg->flags & PG_PINNED) != 0);
+}
+
+// Drop a reference taken by kref_get(). Returns the references left;
+// at 0 the frame is the caller's to free.
+int
+kref_drop(uint pa)
+{
+  struct page *pg = &kmem.pages[pa >> PTXSHIFT];
+  int n;
+
+  acquire(&kmem.rmaplock);
+  n = kref_dec(pg);
+  release(&kmem.rmaplock);
+  return n;
+}
+
+// Drop a reference taken by kref_get(), freeing pa if it was the last.
+void
+kref_put(uint pa)
+{
+  if(kref_drop(pa) == 0)
+    kfree(P2V(pa));
+}
+
+// pte, which the caller found mapping pa, is being cleared or pointed
+// elsewhere: set it to val and drop it from pa's mappers, unless reclaim
+// has swapped it out meanwhile. Returns the mappers left, or -1 if pte
+// no longer maps pa and was left alone.
+int
+rmap_set(uint pa, pte_t *pte, pte_t val)
+{
+  struct page *pg = &kmem.pages[pa >> PTXSHIFT];
+  int n = -1;
+
+  acquire(&kmem.rmaplock);
+  if(rmap_maps(pg, pa, pte)){
+    rmap_remove(pg, pte);
+    n = kref_dec(pg);
+    *pte = val;
+  }
+  release(&kmem.rmaplock);
+  return n;
+}
+
+// Make to a further, read-only mapping of pa like from, which the
+// caller found mapping it, and take from's write access away too, using
+// a node set aside by rmap_reserve(). Returns -1, leaving the node set
+// aside, if reclaim swapped from out meanwhile.
+int
+rmap_dup(uint pa, pte_t *from, pte_t *to)
+{
+  struct page *pg = &kmem.pages[pa >> PTXSHIFT];
+  int r = -1;
+
+  acquire(&kmem.rmaplock);
+  if(rmap_maps(pg, pa, from)){
+    *from &= ~PTE_W;
+    *to = *from;
+    rmap_add(pg, to, 1);
+    pg->refcnt += 1;
+    r = 0;
+  }
+  release(&kmem.rmaplock);
+  return r;
+}
+
+// Swap out pa: replace each PTE still mapping it with the swap entry
+// swp, keeping its flags less PTE_P, and drop it from pa's mappers. The
+// PTEs and their old flags go in ptes and flags. Returns how many, or
+// -1, changing nothing, if pa has more than max mappers.
+int
+rmap_unmap(uint pa, uint swp, pte_t **ptes, uint *flags, int max)
+{
+  struct page *pg = &kmem.pages[pa >> PTXSHIFT];
+  struct rmap_node *n;
+  int i, k, nmap;
+
+  acquire(&kmem.rmaplock);
+  nmap = 0;
+  if(pg->pte)
+    ptes[nmap++] = pg->pte;
+  for(n = pg->chain; n; n = n->next){
+    if(nmap == max){
+      release(&kmem.rmaplock);
+      return -1;
     }
+    ptes[nmap++] = n->pte;
+  }
+  for(i = k = 0; i < nmap; i++){
+    if(!rmap_maps(pg, pa, ptes[i]))
+      continue;
+    // Exchange the entry so that a PTE_D another CPU sets meanwhile is
+    // seen, not overwritten.
+    flags[k] = PTE_FLAGS(xchg(ptes[i], swp | (PTE_FLAGS(*ptes[i]) & ~PTE_P)));
+    rmap_remove(pg, ptes[i]);
+    pg->refcnt -= 1;
+    ptes[k++] = ptes[i];
+  }
+  release(&kmem.rmaplock);
+  return k;
+}
+
+// Pin page v: kfree() leaves it alone and reclaim does not pick it
+// while it is pinned.
+void
+kpin(char *v)
+{
+  acquire(&kmem.rmaplock);
+  kmem.pages[V2P(v) >> PTXSHIFT].flags |= PG_PINNED;
+  release(&kmem.rmaplock);
+}
+
+// Unpin page v. Returns 1 if nobody maps it any more, in which case the
+// caller must free it: a mapper that dropped the last reference while it
+// was pinned left that to us (see kref_dec).
+int
+kunpin(char *v)
+{
+  struct page *pg = &kmem.pages[V2P(v) >> PTXSHIFT];
+  int last;
+
+  acquire(&kmem.rmaplock);
+  pg->flags &= ~PG_PINNED;
+  last = pg->refcnt == 0;
+  release(&kmem.rmaplock);
+  return last;
+}
+
+int
+kpinned(uint pa)
+{
+  return (kmem.pages[pa >> PTXSHIFT].flags & PG_PINNED) != 0;
+}
+
+// Page-table pages can be shared between page directories after fork.
+// These count the sharers; a table that was never shared counts as one.
+void
+pgtab_ref(char *pgtab)
+{
+  struct page *pg = &kmem.pages[V2P(pgtab) >> PTXSHIFT];
+
+  acquire(&kmem.rmaplock);
+  pg->ptref = pg->ptref ? pg->ptref + 1 : 2;
+  release(&kmem.rmaplock);
+}
+
+// Drop one sharer of pgtab and return how many are left.
+int
+pgtab_unref(char *pgtab)
+{
+  struct page *pg = &kmem.pages[V2P(pgtab) >> PTXSHIFT];
+  int n;
+
+  acquire(&kmem.rmaplock);
+  n = pg->ptref ? pg->ptref - 1 : 0;
+  pg->ptref = n;
+  release(&kmem.rmaplock);
+  return n;
+}
+
+int
+pgtab_nref(char *pgtab)
+{
+  int n = kmem.pages[V2P(pgtab) >> PTXSHIFT].ptref;
+  return n ? n : 1;
+}
+
+// Copy up to max of the PTEs mapping pa into ptes and return how many
+// there were. The caller may then change the rmap while walking the copy.
+int
+rmap_ptes(uint pa, pte_t **ptes, int max)
+{
+  struct page *pg;
+  struct rmap_node *n;
+  int i;
+
+  if(pa >= PHYSTOP || pa < (uint)V2P(end))
+    panic("rmap_ptes: pa out of bounds");
+  acquire(&kmem.rmaplock);
+  pg = &kmem.pages[pa >> PTXSHIFT];
+  i = 0;
+  if(pg->pte && i < max)
+    ptes[i++] = pg->pte;
+  for(n = pg->chain; n && i < max; n = n->next)
+    ptes[i++] = n->pte;
+  release(&kmem.rmaplock);
+  return i;
+}
+
+// Clear PTE_W in every PTE mapping pa, copying up to max of them into
+// ptes for the caller to shoot down. Returns how many there were.
+int
+rmap_wrprotect(uint pa, pte_t **ptes, int max)
+{
+  struct page *pg;
+  struct rmap_node *n;
+  int i;
+
+  acquire(&kmem.rmaplock);
+  pg = &kmem.pages[pa >> PTXSHIFT];
+  i = 0;
+  if(pg->pte){
+    *pg->pte &= ~PTE_W;
+    if(i < max)
+      ptes[i++] = pg->pte;
   }
-  for(int j= index+1 ; j< NPROC; ++j){
-    kmem.rmap_2D[pa >> PTXSHIFT][j-1] = kmem.rmap_2D[pa >> PTXSHIFT][j];
-    kmem.rmap_2D[pa >> PTXSHIFT][j] = 0;
+  for(n = pg->chain; n; n = n->next){
+    *n->pte &= ~PTE_W;
+    if(i < max)
+      ptes[i++] = n->pte;
   }
+  release(&kmem.rmaplock);
+  return i;
+}
+
+// Clear PTE_A in every PTE mapping pa. Returns 1 if any of them had
+// it set, that is, if the page was used since the last call.
+int
+rmap_referenced(uint pa)
+{
+  struct page *pg;
+  struct rmap_node *n;
+  int r;
 
-    *ref_count += increment;
+  acquire(&kmem.rmaplock);
+  pg = &kmem.pages[pa >> PTXSHIFT];
+  r = 0;
+  if(pg->pte){
+    r |= (*pg->pte & PTE_A) != 0;
+    *pg->pte &= ~PTE_A;
   }
-  else
-    panic("update_ref_count: increment should be either 1 or -1");
-  release(&kmem.lock);
+  for(n = pg->chain; n; n = n->next){
+    r |= (*n->pte & PTE_A) != 0;
+    *n->pte &= ~PTE_A;
+  }
+  release(&kmem.rmaplock);
+  return r;
 }
 
-pte_t * mylist(uint phy_addr, int column){
-  if(phy_addr >= PHYSTOP || phy_addr < (uint)V2P(end)){
-    panic("false");
+// Move every PTE mapping frame from over to frame to, read-only, copying
+// them into ptes, and return how many were moved. The caller has write
+// protected both frames and found them identical; if since then any
+// mapper of either got write access back, or a mapper of from was
+// swapped out, the contents may differ and nothing is moved (returns
+// -1). Nor is anything moved if to would end up with more than max
+// mappers. The caller shoots down the moved PTEs and frees from.
+int
+rmap_merge(uint from, uint to, pte_t **ptes, int max)
+{
+  struct page *pf, *pt;
+  struct rmap_node *n;
+  int i, k;
+
+  acquire(&kmem.rmaplock);
+  pf = &kmem.pages[from >> PTXSHIFT];
+  pt = &kmem.pages[to >> PTXSHIFT];
+  if(pf->refcnt == 0 || pt->refcnt == 0 || pf->refcnt + pt->refcnt > max ||
+     (pf->flags & PG_PINNED))
+    goto fail;
+  i = 0;
+  if(pf->pte)
+    ptes[i++] = pf->pte;
+  for(n = pf->chain; n; n = n->next)
+    ptes[i++] = n->pte;
+  for(k = 0; k < i; k++)
+    if((*ptes[k] & (PTE_P|PTE_W)) != PTE_P || PTE_ADDR(*ptes[k]) != from)
+      goto fail;
+  if(pt->pte && (*pt->pte & PTE_W))
+    goto fail;
+  for(n = pt->chain; n; n = n->next)
+    if(*n->pte & PTE_W)
+      goto fail;
+  // Each removal from pf but the last frees a node for the next add to
+  // pt, so one spare node is enough.
+  rmap_refill();
+  if(kmem.rmap_nfree <= kmem.rmap_reserved)
+    goto fail;
+  for(k = 0; k < i; k++){
+    rmap_remove(pf, ptes[k]);
+    pf->refcnt -= 1;
+    *ptes[k] = to | PTE_FLAGS(*ptes[k]);
+    rmap_add(pt, ptes[k], 0);
+    pt->refcnt += 1;
+  }
+  release(&kmem.rmaplock);
+  return i;
+
+fail:
+  release(&kmem.rmaplock);
+  return -1;
+}
+
+// Give pte, which maps pa, write access if it is pa's only mapper.
+// Returns -1 if pa is shared after all and must be copied instead.
+// The check and the update are done under the lock so that a page
+// being merged cannot turn writable under rmap_merge().
+int
+rmap_mkwrite(uint pa, pte_t *pte)
+{
+  struct page *pg = &kmem.pages[pa >> PTXSHIFT];
+  int r = -1;
+
+  acquire(&kmem.rmaplock);
+  if(pg->refcnt == 1 && !(pg->flags & PG_PINNED) && PTE_ADDR(*pte) == pa){
+    *pte |= PTE_W;
+    r = 0;
   }
-  pte_t* answer_pte = kmem.rmap_2D[phy_addr >> PTXSHIFT][column];
-  return answer_pte;
+  release(&kmem.rmaplock);
+  return r;
 }
 
 // function to obtain the reference count of a page [This is diff from get_ref_count_without_locks since we are applying locks here and this function is called by pagefault handler]
@@ -199,10 +1107,37 @@ uint get_count_ref(uint pa){
   if (pa >= PHYSTOP || pa < (uint) V2P(end))
     panic("get_ref_count: pa out of bounds");
   
-  acquire(&kmem.lock);
+  acquire(&kmem.rmaplock);
   char* v = P2V(pa);
   int* ref_count = get_ref_count_without_locks(v); // Notice how we are not applying any locks here since lock has been applied before calling this function
   // cprintf("Reference count of page at address %x is %d\n", v, *ref_count);
-  release(&kmem.lock);
+  release(&kmem.rmaplock);
   return (uint) *ref_count;
 }
+
+// Fill in the allocator's part of a vmstat.
+void
+kmemstat(struct vmstat *st)
+{
+  st->nfree = num_of_FreePages();
+  for(int i = 0; i < NCPU; i++)
+    st->pcpfree += kmem.mag[i].n;
+  acquire(&kmem.zlock);
+  st->zpool = kmem.nzero;
+  st->zhits = kmem.zhits;
+  st->zmisses = kmem.zmisses;
+  st->kswapd_wakeups = kmem.kswapd_wakeups;
+  st->kswapd_pages = kmem.kswapd_pages;
+  st->direct_reclaims = kmem.direct_reclaims;
+  release(&kmem.zlock);
+  acquire(&kmem.lock);
+  for(int i = 0; i < NORDER; i++)
+    st->nblocks[i] = kmem.nfree_area[i];
+  release(&kmem.lock);
+  acquire(&kmem.rmaplock);
+  st->rmap_pages = kmem.rmap_pages;
+  st->rmap_nodes = kmem.rmap_pages * RMAP_PER_PAGE - kmem.rmap_nfree;
+  st->rmap_bytes = sizeof(kmem.pages) + sizeof(kmem.rmap_hash) +
+                  kmem.rmap_pages * PGSIZE;
+  release(&kmem.rmaplock);
+}
@@ -0,0 +1,180 @@
+// Same-page merging. The ksmd kernel thread walks physical memory a few
+// pages at a time and hashes every user page it finds. A page whose hash
+// matches one seen earlier is compared with it byte for byte, and if the
+// two are identical all mappers of the newer one are moved onto the
+// older, read-only, and its frame is freed. A later write breaks the
+// sharing again through the ordinary COW fault.
+//
+// Scanning is off until enabled with vmctl(VMCTL_KSM_PAGES, n).
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "vmstat.h"
+
+#define KSM_HASHSZ  256  // candidate table entries
+#define KSM_MAXMAP  NPROC  // mappers of a merged frame; swap-out handles NPROC
+#define KSM_SLEEP   10   // default ticks between scan passes
+
+extern char end[];
+
+struct ksmcand {
+  uint pa;    // 0 if empty
+  uint sum;   // checksum of pa's contents when it was seen
+};
+
+struct {
+  struct spinlock lock;
+  int npages;     // pages looked at per pass; 0 turns scanning off
+  int sleep;      // ticks between passes
+  uint next;      // next physical page to look at
+  uint scanned;   // user pages hashed
+  uint saved;     // frames freed by merging
+  uint failed;    // candidates that turned out to differ
+  struct ksmcand tab[KSM_HASHSZ];
+} ksm;
+
+void
+ksminit(void)
+{
+  initlock(&ksm.lock, "ksm");
+  ksm.sleep = KSM_SLEEP;
+}
+
+static uint
+ksm_sum(uint *p)
+{
+  uint h = 2166136261U;
+  int i;
+
+  for(i = 0; i < PGSIZE / sizeof(uint); i++)
+    h = (h ^ p[i]) * 16777619U;
+  return h;
+}
+
+// Write protect pa and into, then merge pa into into if the two are
+// identical. Reclaim is held off throughout, so that neither frame is
+// swapped out and freed under the merge. Returns 1 if pa was freed.
+static int
+ksm_merge(uint pa, uint into)
+{
+  pte_t *ptes[KSM_MAXMAP];
+  uint mask;
+  int i, n, r;
+
+  reclaim_lock();
+  r = 0;
+  if(get_count_ref(pa) == 0 || get_count_ref(into) == 0)
+    goto out;
+  mask = 0;
+  n = rmap_wrprotect(pa, ptes, KSM_MAXMAP);
+  for(i = 0; i < n; i++)
+    mask |= tlb_shootdown_pte(ptes[i]);
+  n = rmap_wrprotect(into, ptes, KSM_MAXMAP);
+  for(i = 0; i < n; i++)
+    mask |= tlb_shootdown_pte(ptes[i]);
+  tlb_shootdown_sync(mask);
+
+  if(memcmp(P2V(pa), P2V(into), PGSIZE) != 0)
+    goto out;
+  if((n = rmap_merge(pa, into, ptes, KSM_MAXMAP)) < 0)
+    goto out;
+  mask = 0;
+  for(i = 0; i < n; i++)
+    mask |= tlb_shootdown_pte(ptes[i]);
+  tlb_shootdown_sync(mask);
+  if(get_count_ref(pa) == 0)
+    kfree(P2V(pa));
+  r = 1;
+out:
+  reclaim_unlock();
+  return r;
+}
+
+// Look at the user page at pa, if it is one.
+static void
+ksm_scan(uint pa)
+{
+  struct ksmcand *c;
+  uint sum;
+
+  if(iszeropage(pa) || kpinned(pa) || get_count_ref(pa) == 0)
+    return;
+  sum = ksm_sum((uint*)P2V(pa));
+  ksm.scanned += 1;
+  c = &ksm.tab[sum % KSM_HASHSZ];
+  // The candidate may have been freed or reused since; memcmp() under
+  // write protection is what decides, the checksum only narrows it down.
+  if(c->pa && c->pa != pa && c->sum == sum && get_count_ref(c->pa) > 0 &&
+     !kpinned(c->pa)){
+    if(ksm_merge(pa, c->pa))
+      ksm.saved += 1;
+    else
+      ksm.failed += 1;
+    return;
+  }
+  c->pa = pa;
+  c->sum = sum;
+}
+
+void
+ksmd(void)
+{
+  uint t0, lo;
+  int i;
+
+  lo = PGROUNDUP(V2P(end));
+  ksm.next = lo;
+  for(;;){
+    acquire(&ksm.lock);
+    while(ksm.npages == 0)
+      sleep(&ksm, &ksm.lock);
+    release(&ksm.lock);
+
+    acquire(&tickslock);
+    t0 = ticks;
+    while(ticks - t0 < ksm.sleep)
+      sleep(&ticks, &tickslock);
+    release(&tickslock);
+
+    for(i = 0; i < ksm.npages; i++){
+      ksm_scan(ksm.next);
+      ksm.next += PGSIZE;
+      if(ksm.next >= PHYSTOP)
+        ksm.next = lo;
+    }
+  }
+}
+
+// vmctl: set how many pages ksmd scans per pass (0 stops it) or how many
+// ticks it sleeps between passes. Returns the old value.
+int
+ksmctl(int cmd, int arg)
+{
+  int old;
+
+  if(arg < 0)
+    return -1;
+  acquire(&ksm.lock);
+  if(cmd == VMCTL_KSM_PAGES){
+    old = ksm.npages;
+    ksm.npages = arg;
+    wakeup(&ksm);
+  } else {
+    old = ksm.sleep;
+    ksm.sleep = arg;
+  }
+  release(&ksm.lock);
+  return old;
+}
+
+void
+ksmstat(struct vmstat *st)
+{
+  st->ksm_scanned = ksm.scanned;
+  st->ksm_saved = ksm.saved;
+  st->ksm_failed = ksm.failed;
+}
@@ -28,13 +28,20 @@ main(void)
   uartinit();      // serial port
   pinit();         // process table
   tvinit();        // trap vectors
+  tlbqinit();      // TLB shootdown queues
   binit();         // buffer cache
+  pcacheinit();    // program page cache
+  ksminit();       // same-page merging
   fileinit();      // file table
   ideinit();       // disk 
   swapinit(ROOTDEV);  // swap slots initialization
+  zswapinit();     // compressed swap pool
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
   userinit();      // first user process
+  kthread_create("kzerod", kzerod);  // background page zeroing
+  kthread_create("ksmd", ksmd);      // same-page merging
+  kthread_create("kswapd", kswapd);  // background reclaim
   mpmain();        // finish this processor's setup
 }
 
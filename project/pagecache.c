@@ -0,0 +1,178 @@
+// Cache of program pages read in from files, keyed by inode and file
+// offset. Every process running the same binary maps the cached frame
+// read-only instead of reading its own copy; a write breaks the sharing
+// like any other COW fault. Cached frames are pinned: kfree() leaves
+// them alone and reclaim does not swap them out. A cached page that no
+// process maps any more is given back when memory runs short.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "vmstat.h"
+
+#define NPCACHE 64  // cached pages
+
+struct pcentry {
+  uint dev;
+  uint inum;
+  uint off;     // file offset of the page's first byte
+  char *page;   // 0 if the entry is free
+};
+
+struct {
+  struct spinlock lock;
+  struct pcentry e[NPCACHE];
+  uint n;       // entries in use
+  uint hand;    // next entry to consider for eviction
+  uint hits;
+  uint misses;
+} pcache;
+
+void
+pcacheinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+// Drop entry e. Must hold pcache.lock.
+static void
+pcache_drop(struct pcentry *e)
+{
+  char *page = e->page;
+
+  e->page = 0;
+  pcache.n -= 1;
+  if(kunpin(page))
+    kfree(page);
+}
+
+static struct pcentry*
+pcache_find(uint dev, uint inum, uint off)
+{
+  struct pcentry *e;
+
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++)
+    if(e->page && e->dev == dev && e->inum == inum && e->off == off)
+      return e;
+  return 0;
+}
+
+// Map at the empty PTE pte, read-only, the page of ip holding n bytes
+// from offset off (zero-filled past them), reading it in if it is not
+// cached yet. The mapping is made under pcache.lock so the page cannot
+// be evicted under us. Returns -1 if the file could not be read.
+int
+pcache_map(struct inode *ip, uint off, uint n, pte_t *pte)
+{
+  struct pcentry *e;
+  char *mem;
+  int i;
+
+  acquire(&pcache.lock);
+  if((e = pcache_find(ip->dev, ip->inum, off)) != 0){
+    pcache.hits += 1;
+    goto map;
+  }
+  pcache.misses += 1;
+  release(&pcache.lock);
+
+  if((mem = kalloc_zeroed()) == 0)
+    return -1;
+  ilock(ip);
+  if(readi(ip, mem, off, n) != n){
+    iunlock(ip);
+    kfree(mem);
+    return -1;
+  }
+  iunlock(ip);
+
+  acquire(&pcache.lock);
+  if((e = pcache_find(ip->dev, ip->inum, off)) != 0){
+    // Someone else read it in meanwhile.
+    kfree(mem);
+    goto map;
+  }
+  if(pcache.n == NPCACHE){
+    // Full: evict the next entry round the clock, preferring a page
+    // nobody maps. A mapped page just stops being shared with new
+    // mappers.
+    for(i = 0; i < NPCACHE - 1; i++){
+      if(get_count_ref(V2P(pcache.e[pcache.hand].page)) == 0)
+        break;
+      pcache.hand = (pcache.hand + 1) % NPCACHE;
+    }
+    pcache_drop(&pcache.e[pcache.hand]);
+    pcache.hand = (pcache.hand + 1) % NPCACHE;
+  }
+  for(e = pcache.e; e->page; e++)
+    ;
+  e->dev = ip->dev;
+  e->inum = ip->inum;
+  e->off = off;
+  e->page = mem;
+  pcache.n += 1;
+  kpin(mem);
+
+map:
+  *pte = V2P(e->page) | PTE_P | PTE_U;
+  if(update_ref_count(V2P(e->page), 1, pte) < 0){
+    *pte = 0;
+    release(&pcache.lock);
+    return -1;
+  }
+  release(&pcache.lock);
+  return 0;
+}
+
+// ip's contents are changing: forget its pages. Processes that have
+// them mapped keep the old contents.
+void
+pcache_invalidate(struct inode *ip)
+{
+  struct pcentry *e;
+
+  if(pcache.n == 0)
+    return;
+  acquire(&pcache.lock);
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++)
+    if(e->page && e->dev == ip->dev && e->inum == ip->inum)
+      pcache_drop(e);
+  release(&pcache.lock);
+}
+
+// Free cached pages that no process maps. Called by kalloc() before it
+// resorts to swapping. Returns the number of pages freed.
+int
+pcache_shrink(void)
+{
+  struct pcentry *e;
+  int n;
+
+  if(pcache.n == 0)
+    return 0;
+  n = 0;
+  acquire(&pcache.lock);
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++)
+    if(e->page && get_count_ref(V2P(e->page)) == 0){
+      pcache_drop(e);
+      n++;
+    }
+  release(&pcache.lock);
+  return n;
+}
+
+void
+pcachestat(struct vmstat *st)
+{
+  acquire(&pcache.lock);
+  st->pcache_pages = pcache.n;
+  st->pcache_hits = pcache.hits;
+  st->pcache_misses = pcache.misses;
+  release(&pcache.lock);
+}
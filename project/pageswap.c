@@ -10,6 +10,7 @@
 #include "fs.h"
 #include "sleeplock.h"
 #include "buf.h"
+#include "vmstat.h"
 
 //? TLB Updates in swap out
 //? Invalidate page in TLB in the Page fault handler function
@@ -18,6 +19,122 @@
 
 struct swap_slot swap_slots[MAX_SWAP_SLOTS];
 
+// Slot allocator: a bitmap of the slots in use. Searches start at the
+// hint, the word the last allocation came from, and skip full words
+// whole, so finding a slot does not get slower as the swap area grows.
+// It can also hand out runs of adjacent slots, which are contiguous on
+// disk. is_free in each slot mirrors its bit.
+#define SWAPMAP_WORDS ((MAX_SWAP_SLOTS + 31) / 32)
+
+struct
+{
+    struct spinlock lock;
+    uint map[SWAPMAP_WORDS];
+    int hint;
+    int used;
+} swapmap;
+
+// Swap I/O goes straight to the disk driver as one request per run of
+// adjacent slots, through these private bufs, so it neither waits for
+// nor pushes out the file system's blocks in the buffer cache.
+#define NSWAPBUF 4
+
+// Reclaim evicts the victim together with up to SWAP_CLUSTER - 1 of the
+// pages mapped after it in the same page table that were not used
+// lately, into adjacent slots, so that they go out in one disk write
+// and a later fault on them is served by read-ahead.
+#define SWAP_CLUSTER 8
+#define RECLAIM_TRIES 4  // victim picks per reclaim before giving up
+
+struct
+{
+    struct spinlock lock;
+    struct buf buf[NSWAPBUF];
+    int busy[NSWAPBUF];
+    uint reads;   // pages read
+    uint writes;  // pages written
+    uint ticks;   // ticks spent waiting for them
+} swapio;
+
+// Page replacement. Each policy picks a PTE mapping the page to evict
+// next; swap_out_batch() then unmaps it from every process sharing it.
+// The policy is chosen at boot with SWAP_POLICY and can be changed with
+// vmctl(VMCTL_SWAPPOLICY). Evictions and swap-ins are counted per
+// policy, against the time it was in use, to compare their fault rates.
+//
+// Apart from the legacy one, the policies sweep physical frames with a
+// hand shared between them and ask the rmap whether any mapper of a
+// frame has PTE_A set.
+
+#ifndef SWAP_POLICY
+#define SWAP_POLICY SWAP_LEGACY
+#endif
+
+#define NFRAME        (PHYSTOP >> PTXSHIFT)
+#define AGING_WINDOW  64   // frames aged and compared per eviction
+#define WS_TAU        100  // ticks a page stays in the working set
+
+extern char end[];
+
+struct swap_policy
+{
+    char *name;
+    pte_t *(*victim)(struct proc **);
+};
+
+struct
+{
+    struct spinlock lock;
+    struct sleeplock reclaim;  // held while choosing and evicting a victim
+    int policy;
+    uint hand;       // next frame the sweeping policies look at
+    uint since;      // ticks when policy was chosen
+    uint outs[NSWAPPOLICY];
+    uint ins[NSWAPPOLICY];
+    uint ticks[NSWAPPOLICY];
+    uchar age[NFRAME];     // aging: reference history, most recent in bit 7
+    uint lastref[NFRAME];  // wsclock: ticks when last seen referenced
+} swapctl;
+
+static void count_swap_in(void);
+
+// Swap cache. A page read back from a disk slot keeps the slot, with no
+// mappers, for as long as it stays clean: it is mapped with PTE_D clear,
+// and if no mapper has set PTE_D by the time it is evicted again the
+// slot still holds its contents, so the frame is just dropped. The
+// slot is given back when the frame is freed, or when reclaim runs out
+// of slots.
+//
+// A slot is busy while its page is being written out or read back.
+// Faults on a busy slot wait, and find the page mapped when they wake,
+// so processes sharing a swapped-out page read it in once.
+struct
+{
+    struct spinlock lock;
+    short slot[NFRAME];  // 1 + the slot holding a clean copy of a frame
+    int n;               // slots held by the cache
+    uint clean;          // evictions that found a clean copy
+    uint shared;         // faults that waited for another's swap-in
+} swapcache;
+
+// Swap read-ahead. A fault on a swapped-out page also swaps in the
+// swapped-out pages right after it in the process, up to the process's
+// read-ahead window, reading those in adjacent slots together, and maps
+// them with PTE_A clear. At the next swap
+// fault the batch is judged by how many of its pages were used since:
+// the window doubles if at least half were, and halves otherwise.
+#define RA_MAX      8   // most pages read ahead per fault
+#define RA_MINFREE  64  // read ahead only while this many pages are free
+
+struct
+{
+    struct spinlock lock;
+    uint pages;  // pages read ahead
+    uint hits;   // of which used before the next swap fault
+} swapra;
+
+static void swap_readahead(struct proc *p, uint va);
+
 // initialize swap slots during booting
 void swapinit(int dev)
 {
@@ -27,6 +144,9 @@ void swapinit(int dev)
         swap_slots[i].is_free = 1;
         swap_slots[i].page_perm = 0;
         swap_slots[i].proc_id = -1;
+        swap_slots[i].zdata = 0;
+        swap_slots[i].zlen = 0;
+        swap_slots[i].busy = 0;
         swap_slots[i].swap_start = i * 8 + 2; // 2 is the starting block of swap slots
         for (int j = 0; j < NPROC; ++j)
         {
@@ -34,71 +154,317 @@ void swapinit(int dev)
             swap_slots[i].page_permmap[j] = 0;
         }
     }
+    initlock(&swapmap.lock, "swapmap");
+    initlock(&swapio.lock, "swapio");
+    initlock(&swapra.lock, "swapra");
+    initlock(&swapcache.lock, "swapcache");
+    for (int i = 0; i < NSWAPBUF; i++)
+        initsleeplock(&swapio.buf[i].lock, "swapbuf");
+    initlock(&swapctl.lock, "swapctl");
+    initsleeplock(&swapctl.reclaim, "reclaim");
+    swapctl.policy = SWAP_POLICY;
+    swapctl.hand = PGROUNDUP(V2P(end));
     // cprintf("Swap slots initialized\n");
 }
 
-// New code
-void page_swap_out(pte_t *victim_pte, struct proc *victim_proc)
+// Move n pages to or from the n slots' worth of blocks at blockno,
+// as a single disk request.
+static void swap_rw(char **pages, int n, uint blockno, int write)
 {
-    cprintf("pages_swap_out\n");
-    if (victim_pte == (void *)-1)
+    struct buf *b;
+    uint t0 = ticks;
+    int i;
+
+    acquire(&swapio.lock);
+    for (;;)
     {
-        panic("No victim page found");
+        for (i = 0; i < NSWAPBUF && swapio.busy[i]; i++)
+            ;
+        if (i < NSWAPBUF)
+            break;
+        sleep(&swapio, &swapio.lock);
     }
-    struct swap_slot *swap_slot = swap_get_free_slot();
-    if (swap_slot == (void *)-1)
+    swapio.busy[i] = 1;
+    release(&swapio.lock);
+
+    b = &swapio.buf[i];
+    acquiresleep(&b->lock);
+    b->dev = ROOTDEV;
+    b->blockno = blockno;
+    b->pages = (uchar **)pages;
+    b->nblocks = n * (PGSIZE / BSIZE);
+    b->flags = write ? B_DIRTY : 0;
+    iderw(b);
+    releasesleep(&b->lock);
+
+    acquire(&swapio.lock);
+    swapio.busy[i] = 0;
+    if (write)
+        swapio.writes += n;
+    else
+        swapio.reads += n;
+    swapio.ticks += ticks - t0;
+    wakeup(&swapio);
+    release(&swapio.lock);
+}
+
+// Read the page kept for swap_slot into mem: decompress it from the
+// zswap pool if it is there, otherwise read it from disk.
+static void read_page(char *mem, struct swap_slot *swap_slot)
+{
+    if (swap_slot->zdata)
     {
-        panic("No free swap slot found");
+        zswap_load(mem, swap_slot);
+        return;
     }
-    uint pa = PTE_ADDR(*victim_pte);
-    write_page_to_disk((char *)P2V(pa), swap_slot);
-    cprintf("page written\n");
-    for(int i=0;i<NPROC;++i){
-        pte_t* pte = (pte_t *) mylist(pa, i);
-        if(pte==0){
-            continue;
+    swap_rw(&mem, 1, swap_slot->swap_start, 0);
+}
+
+static int slot_used(int i)
+{
+    return (swapmap.map[i / 32] >> (i % 32)) & 1;
+}
+
+// Allocate n adjacent swap slots and return the index of the first, or
+// -1 if there is no such run.
+int swap_alloc_run(int n)
+{
+    int pass, i, run;
+
+    acquire(&swapmap.lock);
+    for (pass = 0; pass < 2; pass++)
+    {
+        // From the hint to the end, then from the start.
+        run = 0;
+        for (i = pass == 0 ? swapmap.hint * 32 : 0; i < MAX_SWAP_SLOTS; i++)
+        {
+            if (run == 0 && i % 32 == 0 && swapmap.map[i / 32] == ~0U)
+            {
+                i += 31;
+                continue;
+            }
+            if (slot_used(i))
+            {
+                run = 0;
+                continue;
+            }
+            if (++run < n)
+                continue;
+            for (int j = i - n + 1; j <= i; j++)
+            {
+                swapmap.map[j / 32] |= 1U << (j % 32);
+                swap_slots[j].is_free = 0;
+            }
+            swapmap.used += n;
+            swapmap.hint = i / 32;
+            release(&swapmap.lock);
+            return i - n + 1;
         }
-        (swap_slot->page_permmap)[i] = PTE_FLAGS(*pte);
-        swap_slot->swapmap[i] = pte;
-        *pte = ((swap_slot->swap_start) << PTXSHIFT) | PTE_FLAGS(*pte);
-        *pte &= ~PTE_P| PTE_SWAP;
-        update_ref_count(pa, -1, pte);
-        cprintf("update %x %x\n", pa, *pte);
     }
-    kfree((char*)P2V(pa));
-    cprintf("page_swap_out exited\n");
+    release(&swapmap.lock);
+    return -1;
+}
+
+// Give back a slot: drop any compressed copy, forget its mappers and
+// clear its bit.
+static void slot_release(struct swap_slot *s)
+{
+    int i = s - swap_slots;
 
+    zswap_free(s);
+    for (int j = 0; j < NPROC; j++)
+    {
+        s->swapmap[j] = 0;
+        s->page_permmap[j] = 0;
+    }
+    s->page_perm = 0;
+    s->proc_id = -1;
+    acquire(&swapmap.lock);
+    if (slot_used(i))
+    {
+        swapmap.map[i / 32] &= ~(1U << (i % 32));
+        swapmap.used -= 1;
+        if (i / 32 < swapmap.hint)
+            swapmap.hint = i / 32;
+    }
+    s->is_free = 1;
+    release(&swapmap.lock);
 }
 
-void write_page_to_disk(char *page_start, struct swap_slot *swap_slot)
+// Take the slot holding a clean copy of the frame at pa out of the swap
+// cache. Returns 0 if there is none.
+static struct swap_slot *swapcache_take(uint pa)
 {
-    // cprintf("Writing page to disk\n");
-    int blockno = swap_slot->swap_start;
-    // cprintf("blockno: %d\n", blockno);
-    for (int i = 0; i < 8; i++)
+    int i;
+
+    acquire(&swapcache.lock);
+    i = swapcache.slot[pa >> PTXSHIFT] - 1;
+    if (i >= 0)
     {
-        struct buf *buffer = bread(ROOTDEV, blockno + i);
-        memmove(buffer->data, page_start + i * BSIZE, BSIZE);
-        bwrite(buffer);
-        brelse(buffer);
+        swapcache.slot[pa >> PTXSHIFT] = 0;
+        swapcache.n--;
     }
-    // cprintf("Page written to disk\n");
+    release(&swapcache.lock);
+    return i >= 0 ? &swap_slots[i] : 0;
 }
 
-struct swap_slot *swap_get_free_slot()
+// The frame at pa is being freed: give back the slot with its copy.
+void swapcache_free(uint pa)
 {
-    // cprintf("Getting free slot\n");
-    for (int i = 0; i < MAX_SWAP_SLOTS; i++)
+    struct swap_slot *s;
+
+    if (swapcache.slot[pa >> PTXSHIFT] == 0)
+        return;
+    if ((s = swapcache_take(pa)) != 0)
+        slot_release(s);
+}
+
+// Give back every slot held by the cache. Returns how many.
+static int swapcache_shrink(void)
+{
+    struct swap_slot *s;
+    int n = 0;
+
+    for (int f = 0; f < NFRAME; f++)
     {
-        if (swap_slots[i].is_free == 1)
+        if (swapcache.slot[f] == 0)
+            continue;
+        if ((s = swapcache_take(f << PTXSHIFT)) != 0)
         {
-            swap_slots[i].is_free = 0; // mark it as occupied
-            return &swap_slots[i];     // return the slot number
+            slot_release(s);
+            n++;
         }
     }
-    cprintf("No free slot found\n");
-    return (void *)-1;
+    return n;
+}
+// Swap out the pages mapped by victims[0..n-1], which are distinct
+// frames. A page with a clean copy in the swap cache goes back to that
+// slot without being written; the others get a run of adjacent slots
+// if there is one. Pages that do not fit in the compressed pool are
+// written out with one disk request per run of them in adjacent slots.
+// Each frame is held with kref_get() until its I/O is done, so that it
+// is not freed under us if its owners unmap it meanwhile. Returns the
+// number of pages swapped out, 0 if the victims were all unmapped
+// before they could be taken, or -1 if the swap area is full.
+static int swap_out_batch(pte_t **victims, int n)
+{
+    struct swap_slot *slot[SWAP_CLUSTER];
+    char *page[SWAP_CLUSTER];
+    int write[SWAP_CLUSTER], in_ram[SWAP_CLUSTER], noroom[SWAP_CLUSTER];
+    int gone[SWAP_CLUSTER];
+    int first, fresh, i, j, k, m;
+
+    for (i = m = 0; i < n; i++)
+    {
+        uint pa = PTE_ADDR(*victims[i]);
+        if (kref_get(pa, victims[i]) == 0)
+            page[m++] = (char *)P2V(pa);
+    }
+    if ((n = m) == 0)
+        return 0;
+    fresh = 0;
+    for (i = 0; i < n; i++)
+    {
+        slot[i] = swapcache_take(V2P(page[i]));
+        write[i] = slot[i] == 0;
+        fresh += write[i];
+    }
+    first = fresh > 1 ? swap_alloc_run(fresh) : -1;
+    for (i = k = 0; i < n; i++)
+    {
+        if (slot[i])
+            continue;
+        if (first >= 0)
+        {
+            slot[i] = &swap_slots[first + k++];
+            continue;
+        }
+        if ((j = swap_alloc_run(1)) < 0 && swapcache_shrink() > 0)
+            j = swap_alloc_run(1);
+        if (j < 0)
+        {
+            for (j = i; j < n; j++)
+            {
+                if (slot[j])
+                    slot_release(slot[j]);
+                kref_put(V2P(page[j]));
+            }
+            n = i;
+            break;
+        }
+        slot[i] = &swap_slots[j];
+    }
+    if (n == 0)
+        return -1;
+    acquire(&swapcache.lock);
+    for (i = 0; i < n; i++)
+        slot[i]->busy = 1;
+    release(&swapcache.lock);
+
+    pte_t *ptes[NPROC];
+    uint flags[NPROC];
+    uint shoot = 0;
+    for (i = 0; i < n; i++)
+    {
+        int nptes = rmap_unmap(V2P(page[i]), slot[i]->swap_start << PTXSHIFT,
+                               ptes, flags, NPROC);
+        gone[i] = nptes <= 0;
+        for (j = 0; j < nptes; ++j)
+        {
+            slot[i]->page_permmap[j] = flags[j];
+            slot[i]->swapmap[j] = ptes[j];
+            if (flags[j] & PTE_D)
+                write[i] = 1;
+            shoot |= tlb_shootdown_pte(ptes[j]);
+            rss_pte(ptes[j], -PGSIZE);
+        }
+    }
+    // Nobody may still write to the frames through a stale translation.
+    tlb_shootdown_sync(shoot);
+
+    // Compress the pages into memory if they will go; disk is the fallback.
+    for (i = 0; i < n; i++)
+    {
+        int r = !gone[i] && write[i] ? zswap_store(page[i], slot[i]) : -1;
+        in_ram[i] = r == 0;
+        noroom[i] = r == -2;
+    }
+    for (i = 0; i < n; i = j)
+    {
+        j = i + 1;
+        if (gone[i] || !write[i] || in_ram[i])
+            continue;
+        while (j < n && !gone[j] && write[j] && !in_ram[j] && slot[j] == slot[j - 1] + 1)
+            j++;
+        swap_rw(&page[i], j - i, slot[i]->swap_start, 1);
+    }
+    acquire(&swapcache.lock);
+    for (i = 0; i < n; i++)
+    {
+        slot[i]->busy = 0;
+        if (!gone[i] && !write[i])
+            swapcache.clean++;
+    }
+    wakeup(&swapcache);
+    release(&swapcache.lock);
+
+    // A page that went to disk for lack of room in the compressed pool
+    // becomes a pool page instead of being freed.
+    k = 0;
+    for (i = 0; i < n; i++)
+    {
+        if (gone[i])
+            slot_release(slot[i]);
+        else
+            k++;
+        if (kref_drop(V2P(page[i])) > 0)
+            continue;
+        if (!noroom[i] || !zswap_grow(page[i]))
+            kfree(page[i]);
+    }
+    return k;
 }
+
 static pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
@@ -119,160 +485,542 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
 }
 
 
-void clean_all_slots(pte_t *pte)
+// The slot the PTE at pte names, or 0 if the page is back in memory,
+// the PTE gone, or the slot freed. Must hold swapcache.lock.
+static struct swap_slot *slot_of(pte_t *pte)
 {
-    int slot_id = 0 ;
-    while (slot_id < MAX_SWAP_SLOTS)
-    {   
-        int if_free = swap_slots[slot_id].is_free;
-        if (if_free == 0)
+    pte_t e = *pte;
+    int i;
+
+    if (e == 0 || (e & PTE_P))
+        return 0;
+    i = ((e >> PTXSHIFT) - 2) / 8;
+    if (i < 0 || i >= MAX_SWAP_SLOTS)
+        panic("slot_of: bad swap entry");
+    if (swap_slots[i].is_free)
+        return 0;
+    return &swap_slots[i];
+}
+
+// Wait until no I/O is in flight on the slot the PTE at pte names, and
+// return the slot. Returns 0 if the page is back in memory, or the PTE
+// gone, by then. Must hold swapcache.lock.
+static struct swap_slot *slot_wait(pte_t *pte)
+{
+    struct swap_slot *s;
+
+    while ((s = slot_of(pte)) != 0 && s->busy)
+        sleep(&swapcache, &swapcache.lock);
+    return s;
+}
+
+// The swapped-out PTE at pte is going away: take it off the mappers of
+// its slot, free the slot if nobody else maps it, and clear the PTE.
+// The slot is decoded from the PTE, so freeing a process's swap space
+// costs time in proportion to the pages it has swapped out. Returns -1,
+// leaving the PTE alone, if another mapper's fault brought the page
+// back in meanwhile.
+int swap_drop(pte_t *pte)
+{
+    struct swap_slot *s;
+    int left = 0;
+
+    acquire(&swapcache.lock);
+    if ((s = slot_wait(pte)) == 0)
+    {
+        release(&swapcache.lock);
+        return -1;
+    }
+    for (int j = 0; j < NPROC; j++)
+    {
+        if (s->swapmap[j] == pte)
         {
-            for (int i = NPROC; i >=0; i--)
-            {
-                if (swap_slots[slot_id].swapmap[i] == pte)
-                {
-                    swap_slots[slot_id].swapmap[i] = 0;
-                }
-            }
-            int count = 0;
-            for (int i = 0; i < NPROC; i++)
-            {
-                if (swap_slots[slot_id].swapmap[i] == 0)
-                {
-                    count++;
-                }
-            }
-            if (count == NPROC)
-            {
-                swap_slots[slot_id].is_free = 1;
-                int proc = 0;
-                while (proc < NPROC)
-                {
-                    swap_slots[slot_id].swapmap[proc] = 0;
-                    swap_slots[slot_id].page_permmap[proc] = 0;
-                    proc++;
-                }
-            }
+            s->swapmap[j] = 0;
+            s->page_permmap[j] = 0;
         }
-        slot_id++;
+        else if (s->swapmap[j])
+            left++;
     }
+    *pte = 0;
+    release(&swapcache.lock);
+    if (left == 0)
+        slot_release(s);
+    return 0;
 }
 
-void page_fault_handler(void)
+// Make the swap entry at to (a copy of the one at from) a further mapper
+// of from's swap slot, so the page is read back once, by whichever of
+// them touches it first. Both are left read-only: the page is shared
+// copy-on-write once it is back in memory. Returns -1 if the slot has no
+// room for another mapper, or if the page is back in memory.
+int swap_dup(pte_t *from, pte_t *to)
 {
-    cprintf("Page fault handler\n");
-    uint faulting_address = PGROUNDDOWN(rcr2());
-    struct proc *curproc = myproc();
-    pde_t *pgdir = curproc->pgdir;
-    pte_t *pte = walkpgdir(pgdir, (void *)faulting_address, 0);
+    struct swap_slot *slot;
+    int i, j = -1, k = -1;
 
-    int swap_slot = *pte >> PTXSHIFT; // Get the swap block number from the PTE
-    char *mem = kalloc();
-    if (mem == 0)
+    acquire(&swapcache.lock);
+    if ((slot = slot_wait(from)) == 0)
     {
-        panic("Failed to allocate memory for swapped in page");
+        release(&swapcache.lock);
+        return -1;
     }
-    curproc->rss += PGSIZE;
-    int blockno = swap_slot;
-    for (int i = 0; i < 8; i++)
+    for (i = 0; i < NPROC; i++)
     {
-        struct buf *b = bread(ROOTDEV, blockno + i);
-        memmove(mem + i * BSIZE, (void *)b->data, BSIZE);
-        brelse(b);
+        if (slot->swapmap[i] == from)
+            k = i;
+        else if (slot->swapmap[i] == 0 && j < 0)
+            j = i;
     }
-    int swap_index = (blockno - 2) / 8;
-    int proc_id = 0;
-    while(proc_id < NPROC)
+    if (j < 0 || k < 0)
     {
-        if (swap_slots[swap_index].swapmap[proc_id] == 0)
-        {
-            proc_id++;
+        release(&swapcache.lock);
+        return -1;
+    }
+    slot->page_permmap[k] &= ~PTE_W;
+    slot->swapmap[j] = to;
+    slot->page_permmap[j] = slot->page_permmap[k];
+    *to = *from;
+    release(&swapcache.lock);
+    return 0;
+}
+
+void page_fault_handler(uint faulting_address)
+{
+    struct proc *curproc = myproc();
+    pte_t *pte = walkpgdir(curproc->pgdir, (void *)faulting_address, 0);
+
+    swap_in(pte);
+    swap_readahead(curproc, faulting_address);
+}
+
+// The number of PTEs sharing slot s.
+static int slot_nmap(struct swap_slot *s)
+{
+    int i, n;
+
+    n = 0;
+    for (i = 0; i < NPROC; i++)
+        if (s->swapmap[i])
+            n++;
+    return n;
+}
+
+// Map the page now in mem, just read from the claimed slot s, in every
+// PTE that shares the slot, then let the slot go: to the swap cache if
+// keep is set, else back to the free slots. The caller has reserved an
+// rmap node for each PTE.
+static void slot_map(struct swap_slot *s, char *mem, int keep)
+{
+    int i;
+
+    count_swap_in();
+    // Cache the slot before the frame is mapped and so can be evicted
+    // or freed.
+    if (keep)
+    {
+        acquire(&swapcache.lock);
+        swapcache.slot[V2P(mem) >> PTXSHIFT] = s - swap_slots + 1;
+        swapcache.n++;
+        release(&swapcache.lock);
+    }
+    for (i = 0; i < NPROC; i++)
+    {
+        if (s->swapmap[i] == 0)
             continue;
+        // Keep the saved permissions: a page mapped by several PTEs is
+        // COW-shared and a write will fault and copy it. The page is
+        // clean until written.
+        rmap_map(V2P(mem), s->swapmap[i],
+                 V2P(mem) | (s->page_permmap[i] & ~(PTE_D | PTE_SWAP)) | PTE_P);
+        rss_pte(s->swapmap[i], PGSIZE);
+        if (keep)
+        {
+            s->swapmap[i] = 0;
+            s->page_permmap[i] = 0;
         }
-        pte_t *pte_2 = swap_slots[swap_index].swapmap[proc_id];
-        uint perm = swap_slots[swap_index].page_permmap[proc_id];
-        proc_id ++;
-        *pte_2 = V2P(mem) | perm | PTE_P | PTE_W;
-        *pte_2 &= ~PTE_SWAP;
-        update_ref_count(V2P(mem), 1, pte_2);
-    }
-    swap_slots[swap_index].is_free = 1;
-    int proc_j = NPROC - 1;
-    while (proc_j>=0)
-    {
-        swap_slots[swap_index].swapmap[proc_j] = 0;
-        swap_slots[swap_index].page_permmap[proc_j] = 0;
-        proc_j--;
-    }
-    cprintf("Page fault handler exited\n");
-    return;
+    }
+    acquire(&swapcache.lock);
+    s->busy = 0;
+    wakeup(&swapcache);
+    release(&swapcache.lock);
+    if (!keep)
+        slot_release(s);
 }
 
-void swap_in(pte_t *pte)
+// Read the page of the claimed slot s back in and map it.
+static void slot_swap_in(struct swap_slot *s)
 {
-    // pte_t *pte = walkpgdir(pgdir, (void *)faulting_address, 0)
-    // cprintf("swapping in va %x, pte %x, pid %x\n",faulting_address, *pte, curproc->pid);
-    cprintf("Swapping in\n");
+    char *mem;
+    int keep;
 
-    int swap_slot = *pte >> PTXSHIFT; // Get the swap block number from the PTE
-    char *mem = kalloc();
-    // cprintf("Memory allocated, mem: %d\n", mem);
-    if (mem == 0)
+    if (rmap_reserve(slot_nmap(s)) < 0 || (mem = kalloc()) == 0)
     {
         panic("Failed to allocate memory for swapped in page");
     }
-    myproc()->rss += PGSIZE;
-    int blockno = swap_slot;
-    for (int i = 0; i < 8; i++)
+    // Only a copy on disk is worth keeping; the compressed one is
+    // dropped as it is read.
+    keep = s->zdata == 0;
+    read_page(mem, s);
+    slot_map(s, mem, keep);
+}
+
+// Read the pages of the claimed, adjacent disk slots run[0..n-1] in
+// with one disk request, and map them. If memory has run short they
+// are left swapped out.
+static void slot_swap_in_run(struct swap_slot **run, int n)
+{
+    char *mem[RA_MAX];
+    int i, nmap;
+
+    nmap = 0;
+    for (i = 0; i < n; i++)
+        nmap += slot_nmap(run[i]);
+    if (rmap_reserve(nmap) < 0)
+        goto fail;
+    for (i = 0; i < n; i++)
+    {
+        if ((mem[i] = kalloc()) == 0)
+        {
+            while (--i >= 0)
+                kfree(mem[i]);
+            rmap_unreserve(nmap);
+            goto fail;
+        }
+    }
+    swap_rw(mem, n, run[0]->swap_start, 0);
+    for (i = 0; i < n; i++)
+        slot_map(run[i], mem[i], 1);
+    return;
+
+fail:
+    acquire(&swapcache.lock);
+    for (i = 0; i < n; i++)
+        run[i]->busy = 0;
+    wakeup(&swapcache);
+    release(&swapcache.lock);
+}
+
+static void swap_readahead(struct proc *p, uint va)
+{
+    struct swap_slot *run[RA_MAX], *s;
+    pte_t *pte;
+    int used, n, m;
+    uint a;
+
+    if (p->ra_n > 0)
     {
-        struct buf *b = bread(ROOTDEV, blockno + i);
-        memmove(mem + i * BSIZE, (void *)b->data, BSIZE);
-        brelse(b);
+        used = 0;
+        for (a = p->ra_va; a < p->ra_va + p->ra_n * PGSIZE; a += PGSIZE)
+        {
+            pte = walkpgdir(p->pgdir, (void *)a, 0);
+            if (pte && (*pte & (PTE_P | PTE_A)) == (PTE_P | PTE_A))
+                used++;
+        }
+        if (2 * used >= p->ra_n)
+            p->ra_window = p->ra_window * 2 > RA_MAX ? RA_MAX : p->ra_window * 2;
+        else
+            p->ra_window /= 2;
+        acquire(&swapra.lock);
+        swapra.hits += used;
+        release(&swapra.lock);
     }
-    int swap_index = (blockno - 2) / 8;
-    int proc_id = 0;
-    while(proc_id < NPROC)
+    if (p->ra_window < 1)
+        p->ra_window = 1;
+
+    // Claim the slots of the swapped-out pages that follow. Reclaim put
+    // neighbours in adjacent slots, so a run of them on disk is read with
+    // one request; pages held compressed are decompressed one by one.
+    n = m = 0;
+    for (a = va + PGSIZE; n < p->ra_window && a < p->sz; a += PGSIZE, n++)
     {
-        if (swap_slots[swap_index].swapmap[proc_id] != 0)
+        pte = walkpgdir(p->pgdir, (void *)a, 0);
+        if (pte == 0 || *pte == 0 || (*pte & PTE_P))
+            break;
+        if (num_of_FreePages() < RA_MINFREE + m)
+            break;
+        acquire(&swapcache.lock);
+        if ((s = slot_of(pte)) == 0 || s->busy)
         {
-        pte_t *pte_2 = swap_slots[swap_index].swapmap[proc_id];
-        uint perm = swap_slots[swap_index].page_permmap[proc_id];
-        *pte_2 = V2P(mem);
-        *pte_2 &= ~PTE_SWAP| perm| PTE_P | PTE_W;
-        update_ref_count(V2P(mem), 1, pte_2);
+            release(&swapcache.lock);
+            break;
         }
-        else{
-            proc_id++;
+        s->busy = 1;
+        release(&swapcache.lock);
+        if (s->zdata)
+        {
+            slot_swap_in(s);
             continue;
         }
-        proc_id++;
+        if (m > 0 && s != run[m - 1] + 1)
+        {
+            slot_swap_in_run(run, m);
+            m = 0;
+        }
+        run[m++] = s;
     }
-    int proc_j = NPROC-1;
-    swap_slots[swap_index].is_free = 1;
-    while (proc_j >= 0)
+    if (m > 0)
+        slot_swap_in_run(run, m);
+    // Read-ahead pages start out unreferenced, so the next fault can
+    // tell which were used.
+    for (a = va + PGSIZE; a < va + PGSIZE + n * PGSIZE; a += PGSIZE)
+        if ((pte = walkpgdir(p->pgdir, (void *)a, 0)) != 0 && (*pte & PTE_P))
+            *pte &= ~PTE_A;
+    p->ra_va = va + PGSIZE;
+    p->ra_n = n;
+    acquire(&swapra.lock);
+    swapra.pages += n;
+    release(&swapra.lock);
+}
+
+// Bring the page swapped out at pte back in, mapping it in every PTE
+// that shares its slot. Returns at once if the page is already back.
+void swap_in(pte_t *pte)
+{
+    struct swap_slot *s;
+
+    // Wait for I/O on the slot to finish: it may be the read that brings
+    // our page in, or reclaim still writing it out.
+    acquire(&swapcache.lock);
+    if ((s = slot_wait(pte)) == 0)
     {
-        swap_slots[swap_index].swapmap[proc_j] = 0;
-        swap_slots[swap_index].page_permmap[proc_j] = 0;
-        proc_j--;
+        if (*pte & PTE_P)
+            swapcache.shared++;
+        release(&swapcache.lock);
+        return;
     }
-    cprintf("swap_in exited\n");
-    return;
+    s->busy = 1;
+    release(&swapcache.lock);
+    slot_swap_in(s);
 }
 
+// Can the frame at pa be evicted? Only mapped user pages can.
+static int evictable(uint pa)
+{
+    return !iszeropage(pa) && !kpinned(pa) && get_count_ref(pa) > 0;
+}
 
-// Process Terminate, free the slots and other updates
-// Upon completion of the process, clean the unused swap slots.
-void swap_free(struct proc *p)
+// Advance the hand and return the frame it was on.
+static uint sweep(void)
 {
-    for (int i = 0; i < MAX_SWAP_SLOTS; i++)
+    uint pa = swapctl.hand;
+
+    swapctl.hand += PGSIZE;
+    if (swapctl.hand >= PHYSTOP)
+        swapctl.hand = PGROUNDUP(V2P(end));
+    return pa;
+}
+
+static pte_t *frame_pte(uint pa)
+{
+    pte_t *pte;
+
+    if (pa == 0 || rmap_ptes(pa, &pte, 1) != 1)
+        return (void *)-1;
+    return pte;
+}
+
+// The largest process's first page that was not used lately.
+static pte_t *legacy_victim(struct proc **pp)
+{
+    *pp = find_victim_proc();
+    return find_victim_page(*pp);
+}
+
+// Second chance: the first frame the hand finds unreferenced, clearing
+// the reference bits of the frames it passes. Two sweeps always find
+// one.
+static pte_t *clock_victim(struct proc **pp)
+{
+    uint pa;
+
+    for (int n = 0; n < 2 * NFRAME; n++)
     {
-        if (swap_slots[i].proc_id == p->pid)
-        {
-            swap_slots[i].is_free = 1;
-            swap_slots[i].dev_id = ROOTDEV;
-            swap_slots[i].page_perm = 0;
-            swap_slots[i].proc_id = -1;
-        }
+        pa = sweep();
+        if (evictable(pa) && !rmap_referenced(pa))
+            return frame_pte(pa);
+    }
+    return (void *)-1;
+}
+
+// Shift each frame's reference bit into its age as the hand passes, and
+// evict the frame with the lowest age in a window: the one least used
+// over its last eight samples.
+static pte_t *aging_victim(struct proc **pp)
+{
+    uint pa, best = 0;
+    uchar *age;
+    int seen = 0;
+
+    for (int n = 0; n < NFRAME && seen < AGING_WINDOW; n++)
+    {
+        pa = sweep();
+        if (!evictable(pa))
+            continue;
+        seen++;
+        age = &swapctl.age[pa >> PTXSHIFT];
+        *age = (*age >> 1) | (rmap_referenced(pa) ? 0x80 : 0);
+        if (best == 0 || *age < swapctl.age[best >> PTXSHIFT])
+            best = pa;
+    }
+    return frame_pte(best);
+}
+
+// WSClock: evict the first frame not referenced for WS_TAU ticks, that
+// is, outside its processes' working sets. If every page is in a
+// working set, evict the one unreferenced the longest.
+static pte_t *wsclock_victim(struct proc **pp)
+{
+    uint pa, oldest = 0, now = ticks;
+    uint *last;
+
+    for (int n = 0; n < NFRAME; n++)
+    {
+        pa = sweep();
+        if (!evictable(pa))
+            continue;
+        last = &swapctl.lastref[pa >> PTXSHIFT];
+        if (rmap_referenced(pa))
+            *last = now;
+        else if (now - *last > WS_TAU)
+            return frame_pte(pa);
+        else if (oldest == 0 || *last < swapctl.lastref[oldest >> PTXSHIFT])
+            oldest = pa;
+    }
+    return frame_pte(oldest);
+}
+
+static struct swap_policy policies[NSWAPPOLICY] = {
+    [SWAP_LEGACY]  = { "legacy", legacy_victim },
+    [SWAP_CLOCK]   = { "clock", clock_victim },
+    [SWAP_AGING]   = { "aging", aging_victim },
+    [SWAP_WSCLOCK] = { "wsclock", wsclock_victim },
+};
+
+// Gather the victim pte and the PTEs after it in its page table that
+// map evictable frames not used lately, up to SWAP_CLUSTER of them, all
+// different frames. Returns how many.
+static int swap_cluster(pte_t *pte, pte_t **victims)
+{
+    pte_t *q;
+    int n, i;
+
+    victims[0] = pte;
+    n = 1;
+    for (q = pte + 1; n < SWAP_CLUSTER && (uint)q % PGSIZE != 0; q++)
+    {
+        if ((*q & (PTE_P | PTE_U | PTE_A)) != (PTE_P | PTE_U) ||
+            !evictable(PTE_ADDR(*q)))
+            continue;
+        for (i = 0; i < n && PTE_ADDR(*victims[i]) != PTE_ADDR(*q); i++)
+            ;
+        if (i == n)
+            victims[n++] = q;
     }
+    return n;
 }
 
+// Evict a cluster of pages. Called by kswapd, and by kalloc() when
+// memory has run out. Reclaimers take turns so that two of them cannot
+// pick the same victim. Returns the number of pages evicted, or -1 if
+// there was nothing to evict or no swap space left.
+int swap_reclaim(void)
+{
+    struct proc *p = 0;
+    pte_t *pte, *victims[SWAP_CLUSTER];
+    int n = 0, tries;
+
+    acquiresleep(&swapctl.reclaim);
+    // The victims' owners may unmap them before they are taken; pick
+    // again a few times if so.
+    for (tries = 0; tries < RECLAIM_TRIES && n == 0; tries++)
+    {
+        pte = policies[swapctl.policy].victim(&p);
+        if (pte == (void *)-1)
+            break;
+        n = swap_out_batch(victims, swap_cluster(pte, victims));
+    }
+    releasesleep(&swapctl.reclaim);
+    if (n <= 0)
+        return -1;
+    acquire(&swapctl.lock);
+    swapctl.outs[swapctl.policy] += n;
+    release(&swapctl.lock);
+    return n;
+}
+
+// Hold off reclaim, for a caller that must not have frames unmapped
+// and freed under it.
+void reclaim_lock(void)
+{
+    acquiresleep(&swapctl.reclaim);
+}
+
+void reclaim_unlock(void)
+{
+    releasesleep(&swapctl.reclaim);
+}
+
+static void count_swap_in(void)
+{
+    acquire(&swapctl.lock);
+    swapctl.ins[swapctl.policy]++;
+    release(&swapctl.lock);
+}
+
+// Switch to page replacement policy policy. Returns the old one.
+int swap_setpolicy(int policy)
+{
+    int old;
+
+    if (policy < 0 || policy >= NSWAPPOLICY)
+        return -1;
+    acquire(&swapctl.lock);
+    old = swapctl.policy;
+    swapctl.ticks[old] += ticks - swapctl.since;
+    swapctl.since = ticks;
+    swapctl.policy = policy;
+    release(&swapctl.lock);
+    cprintf("page replacement: %s\n", policies[policy].name);
+    return old;
+}
+
+void swapstat(struct vmstat *st)
+{
+    int run = 0;
+
+    acquire(&swapmap.lock);
+    st->swap_slots = MAX_SWAP_SLOTS;
+    st->swap_used = swapmap.used;
+    for (int i = 0; i < MAX_SWAP_SLOTS; i++)
+    {
+        run = slot_used(i) ? 0 : run + 1;
+        if (run > st->swap_maxrun)
+            st->swap_maxrun = run;
+    }
+    release(&swapmap.lock);
+    acquire(&swapcache.lock);
+    st->swap_cached = swapcache.n;
+    st->swap_clean = swapcache.clean;
+    st->swap_shared = swapcache.shared;
+    release(&swapcache.lock);
+    acquire(&swapra.lock);
+    st->swap_ra_pages = swapra.pages;
+    st->swap_ra_hits = swapra.hits;
+    release(&swapra.lock);
+    acquire(&swapio.lock);
+    st->swap_reads = swapio.reads;
+    st->swap_writes = swapio.writes;
+    st->swap_ioticks = swapio.ticks;
+    release(&swapio.lock);
+
+    acquire(&swapctl.lock);
+    st->swap_policy = swapctl.policy;
+    for (int i = 0; i < NSWAPPOLICY; i++)
+    {
+        st->swap_outs[i] = swapctl.outs[i];
+        st->swap_ins[i] = swapctl.ins[i];
+        st->swap_ticks[i] = swapctl.ticks[i];
+    }
+    st->swap_ticks[swapctl.policy] += ticks - swapctl.since;
+    release(&swapctl.lock);
+}
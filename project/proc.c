@@ -6,12 +6,26 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "vmstat.h"
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
 
+// Processes ordered by rss in a binary max-heap, so that reclaim can
+// find the largest without scanning ptable. Ties go to the lower pid.
+// pos[] gives each ptable slot's place in the heap, or -1. rss only
+// changes through rss_add() and rss_set(), which restore the order;
+// they take rssheap.lock so they can be called with or without
+// ptable.lock held.
+struct {
+  struct spinlock lock;
+  struct proc *heap[NPROC];
+  int pos[NPROC];
+  int n;
+} rssheap;
+
 static struct proc *initproc;
 
 int nextpid = 1;
@@ -24,6 +38,115 @@ void
 pinit(void)
 {
   initlock(&ptable.lock, "ptable");
+  initlock(&rssheap.lock, "rssheap");
+  for(int i = 0; i < NPROC; i++)
+    rssheap.pos[i] = -1;
+}
+
+// Should a come before b in the rss heap?
+static int
+rss_above(struct proc *a, struct proc *b)
+{
+  return a->rss > b->rss || (a->rss == b->rss && a->pid < b->pid);
+}
+
+static void
+rss_place(int i, struct proc *p)
+{
+  rssheap.heap[i] = p;
+  rssheap.pos[p - ptable.proc] = i;
+}
+
+// Move the process at heap index i up or down to where it belongs.
+// Must hold rssheap.lock.
+static void
+rss_fix(int i)
+{
+  struct proc *p = rssheap.heap[i];
+  int c;
+
+  while(i > 0 && rss_above(p, rssheap.heap[(i - 1) / 2])){
+    rss_place(i, rssheap.heap[(i - 1) / 2]);
+    i = (i - 1) / 2;
+  }
+  while((c = 2 * i + 1) < rssheap.n){
+    if(c + 1 < rssheap.n && rss_above(rssheap.heap[c + 1], rssheap.heap[c]))
+      c++;
+    if(!rss_above(rssheap.heap[c], p))
+      break;
+    rss_place(i, rssheap.heap[c]);
+    i = c;
+  }
+  rss_place(i, p);
+}
+
+static void
+rss_insert(struct proc *p)
+{
+  acquire(&rssheap.lock);
+  p->rss = 0;
+  rss_place(rssheap.n, p);
+  rss_fix(rssheap.n++);
+  release(&rssheap.lock);
+}
+
+// p is going back to UNUSED.
+static void
+rss_remove(struct proc *p)
+{
+  int i;
+
+  acquire(&rssheap.lock);
+  if((i = rssheap.pos[p - ptable.proc]) >= 0){
+    rssheap.pos[p - ptable.proc] = -1;
+    if(i != --rssheap.n){
+      rss_place(i, rssheap.heap[rssheap.n]);
+      rss_fix(i);
+    }
+  }
+  release(&rssheap.lock);
+}
+
+void
+rss_add(struct proc *p, int delta)
+{
+  int i;
+
+  acquire(&rssheap.lock);
+  p->rss += delta;
+  if((i = rssheap.pos[p - ptable.proc]) >= 0)
+    rss_fix(i);
+  release(&rssheap.lock);
+}
+
+// The page mapped by pte was mapped (delta > 0) or unmapped: charge
+// every process using the page table pte is in, as fork relatives may
+// share it.
+void
+rss_pte(pte_t *pte, int delta)
+{
+  struct proc *p;
+  uint pdx = PDX(pte2va(pte));
+  uint pt = V2P(PGROUNDDOWN((uint)pte));
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state != UNUSED && p->pgdir && (p->pgdir[pdx] & PTE_P) &&
+       PTE_ADDR(p->pgdir[pdx]) == pt)
+      rss_add(p, delta);
+  release(&ptable.lock);
+}
+
+void
+rss_set(struct proc *p, uint rss)
+{
+  int i;
+
+  acquire(&rssheap.lock);
+  p->rss = rss;
+  if((i = rssheap.pos[p - ptable.proc]) >= 0)
+    rss_fix(i);
+  release(&rssheap.lock);
 }
 
 // Must be called with interrupts disabled
@@ -88,6 +211,8 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->ra_n = 0;
+  p->ra_window = 0;
 
   release(&ptable.lock);
 
@@ -96,6 +221,7 @@ found:
     p->state = UNUSED;
     return 0;
   }
+  rss_insert(p);
   sp = p->kstack + KSTACKSIZE;
 
   // Leave room for trap frame.
@@ -126,6 +252,7 @@ userinit(void)
   p = allocproc();
   
   initproc = p;
+  p->heapmode = HEAP_ZERO;
   if((p->pgdir = setupkvm()) == 0)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
@@ -149,6 +276,29 @@ userinit(void)
   release(&ptable.lock);
 }
 
+// Start a kernel thread that runs fn() in the kernel's address space.
+// It has no user memory and fn() must never return.
+struct proc*
+kthread_create(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    panic("kthread_create: no proc");
+  if((p->pgdir = setupkvm()) == 0)
+    panic("kthread_create: out of memory?");
+  p->sz = 0;
+  p->parent = 0;
+  // forkret returns into fn rather than trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+  return p;
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
@@ -158,15 +308,25 @@ growproc(int n)
   struct proc *curproc = myproc();
 
   sz = curproc->sz;
-  if(n > 0){
+  if(n > 0 && curproc->heapmode == HEAP_LAZY){
+    // Only reserve the address space; pages are allocated by
+    // uvmfault() on first touch.
+    if(sz + n >= KERNBASE || sz + n < sz)
+      return -1;
+    sz += n;
+  } else if(n > 0 && curproc->heapmode == HEAP_EAGER){
     if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
+  } else if(n > 0){
+    if((sz = allocuvm_zero(curproc->pgdir, sz, sz + n)) == 0)
+      return -1;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
+    // Growing only adds translations; shrinking must drop stale ones.
+    tlb_flush_range(curproc->pgdir, sz, curproc->sz);
   }
   curproc->sz = sz;
-  switchuvm(curproc);
   return 0;
 }
 
@@ -189,10 +349,12 @@ fork(void)
   if((np->pgdir = copyuvm(np, curproc->pgdir, curproc->sz)) == 0){
     kfree(np->kstack);
     np->kstack = 0;
+    rss_remove(np);
     np->state = UNUSED;
     return -1;
   }
   np->sz = curproc->sz;
+  np->heapmode = curproc->heapmode;
   // np->rss = np->sz;
   np->parent = curproc;
   *np->tf = *curproc->tf;
@@ -204,6 +366,7 @@ fork(void)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  vmacopy(np->vma, curproc->vma);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
@@ -218,6 +381,58 @@ fork(void)
   return pid;
 }
 
+// Start a child running the program at path. It is built straight from
+// exec's loader, so unlike fork and exec the caller's address space is
+// never copied. The child takes over the open files in ofile, which the
+// caller has prepared. Returns the child's pid, or -1.
+int
+spawn(char *path, char **argv, struct file **ofile)
+{
+  int i;
+  uint eip, esp;
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if((np = allocproc()) == 0)
+    goto bad;
+
+  if(execload(path, argv, &np->pgdir, &np->sz, &eip, &esp, np->vma, np) < 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    rss_remove(np);
+    np->state = UNUSED;
+    goto bad;
+  }
+  np->heapmode = curproc->heapmode;
+  np->parent = curproc;
+
+  memset(np->tf, 0, sizeof(*np->tf));
+  np->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+  np->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+  np->tf->es = np->tf->ds;
+  np->tf->ss = np->tf->ds;
+  np->tf->eflags = FL_IF;
+  np->tf->eip = eip;
+  np->tf->esp = esp;
+
+  for(i = 0; i < NOFILE; i++)
+    np->ofile[i] = ofile[i];
+  np->cwd = idup(curproc->cwd);
+  safestrcpy(np->name, execname(path), sizeof(np->name));
+
+  acquire(&ptable.lock);
+  np->state = RUNNABLE;
+  release(&ptable.lock);
+
+  return np->pid;
+
+bad:
+  for(i = 0; i < NOFILE; i++)
+    if(ofile[i])
+      fileclose(ofile[i]);
+  return -1;
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
@@ -241,6 +456,7 @@ exit(void)
 
   begin_op();
   iput(curproc->cwd);
+  vmaclear(curproc->vma);
   end_op();
   curproc->cwd = 0;
 
@@ -264,21 +480,6 @@ exit(void)
   panic("zombie exit");
 }
 
-void clear_all_entries(struct proc* proc){
-  int entry = NPDENTRIES-1;
-  while(entry>=0){
-          if((proc->pgdir[entry] & PTE_P)){
-              pte_t* pte_temp = (pte_t*)P2V(PTE_ADDR(proc->pgdir[entry]));
-              for(int k=0; k<NPTENTRIES ;++k){
-                  int flag = pte_temp[k] & PTE_P;
-                  if(!(flag)){
-                      clean_all_slots(&pte_temp[k]);
-                  }
-              }
-          }
-          entry--;
-        }
-}
 // Wait for a child process to exit and return its pid.
 // Return -1 if this process has no children.
 int
@@ -298,11 +499,15 @@ wait(void)
       havekids = 1;
       if(p->state == ZOMBIE){
         // Found one.
-        clear_all_entries(p);
         pid = p->pid;
         kfree(p->kstack);
         p->kstack = 0;
+        // Freeing swapped-out pages may wait for swap I/O. The child
+        // stays ZOMBIE meanwhile, but reclaim no longer picks it.
+        rss_remove(p);
+        release(&ptable.lock);
         freevm_p(p->pgdir,p);
+        acquire(&ptable.lock);
         p->pid = 0;
         p->parent = 0;
         p->name[0] = 0;
@@ -352,6 +557,7 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  int ran;
   c->proc = 0;
   
   for(;;){
@@ -360,9 +566,11 @@ scheduler(void)
 
     // Loop over process table looking for process to run.
     acquire(&ptable.lock);
+    ran = 0;
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
       if(p->state != RUNNABLE)
         continue;
+      ran = 1;
 
       // Switch to chosen process.  It is the process's job
       // to release ptable.lock and then reacquire it
@@ -373,6 +581,7 @@ scheduler(void)
 
       swtch(&(c->scheduler), p->context);
       switchkvm();
+      c->pgdir = 0;
 
       // Process is done running for now.
       // It should have changed its p->state before coming back.
@@ -380,6 +589,10 @@ scheduler(void)
     }
     release(&ptable.lock);
 
+    // Nothing to run: put the idle time into zeroing free pages.
+    if(!ran)
+      kzero_idle();
+
   }
 }
 
@@ -563,80 +776,60 @@ procdump(void)
 
 struct proc *find_victim_proc(void)
 {
-  cprintf("Finding victim process\n");
-  struct proc *p;
-  struct proc *victim = ptable.proc;
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-  {
-    if (p->state != UNUSED)
-    {
-      if ((p->rss) > (victim->rss))
-      {
-        victim = p;
-      }
-      if ((p->rss) == (victim->rss) && p->pid < victim->pid)
-      {
-        victim = p;
-      }
-    }
-  }
-  // if(victim == 0)
-  //   cprintf("No victim found\n");
-  cprintf("Victim process found, pid: %d\n", victim->pid);
+  struct proc *victim = 0;
+  acquire(&rssheap.lock);
+  if (rssheap.n > 0)
+    victim = rssheap.heap[0];
+  release(&rssheap.lock);
   return victim;
 }
 
+// Can reclaim take the page mapped by pte?
+static int
+victim_ok(pte_t pte)
+{
+  return (pte & (PTE_P | PTE_U)) == (PTE_P | PTE_U) &&
+         !iszeropage(PTE_ADDR(pte)) && !kpinned(PTE_ADDR(pte));
+}
+
+// A page of victim_proc that reclaim can take and that was not used
+// lately. If all were, clear PTE_A on the first tenth of them and look
+// once more. Returns (pte_t*)-1 if there is none.
 pte_t *find_victim_page(struct proc *victim_proc)
 {
-  cprintf("Finding victim page\n");
-  pde_t *page_dir = victim_proc->pgdir;
-  pde_t *pde;
-  pte_t *pde_table;
-  pte_t *victim_page = (void *)-1;
-  for (int i = 0; i < NPDENTRIES; i++)
-  {
-    pde = &page_dir[i];
-    if (!(*pde & PTE_P))
-    {
-      continue;
-    }
-    pde_table = (pte_t *) P2V(PTE_ADDR(*pde));
-    for (int j = 0; j < NPTENTRIES; j++)
-    {
-      victim_page = &pde_table[j];
-      if ((*victim_page & PTE_P) && (*victim_page & PTE_U) && (!(*victim_page & PTE_A))){
-          cprintf("Victim page found without having to remove 10 percent of the pages\n");
-          return victim_page;
+  pde_t *pgdir;
+  pte_t *pt;
+  int i, j, pass, n, count;
+
+  if(victim_proc == 0)
+    return (void *)-1;
+  pgdir = victim_proc->pgdir;
+  for(pass = 0; pass < 2; pass++){
+    n = 0;
+    for(i = 0; i < PDX(KERNBASE); i++){
+      if(!(pgdir[i] & PTE_P))
+        continue;
+      pt = (pte_t *)P2V(PTE_ADDR(pgdir[i]));
+      for(j = 0; j < NPTENTRIES; j++){
+        if(!victim_ok(pt[j]))
+          continue;
+        if(!(pt[j] & PTE_A))
+          return &pt[j];
+        n++;
       }
     }
-  }
-  int count = (victim_proc->rss + 9) / 10;
-    int flag = 0;
-    for (int i = 0; i < NPDENTRIES; ++i)
-    {
-        if (victim_proc->pgdir[i] & PTE_P)
-        {
-            pte_t *pt = (pte_t *)P2V(PTE_ADDR(victim_proc->pgdir[i]));
-            for (int j = 0; j < NPTENTRIES; ++j)
-            {
-                if ((pt[j] & PTE_P) && (pt[j] & PTE_U) && (pt[j] & PTE_A))
-                {
-                    if (count > 0)
-                    {
-                        pt[j] &= ~PTE_A;
-                    }
-                    else
-                    {
-                        flag ++;
-                        break;
-                    }
-                }
-                count--;
-            }
+    count = (n + 9) / 10;
+    for(i = 0; i < PDX(KERNBASE) && count > 0; i++){
+      if(!(pgdir[i] & PTE_P))
+        continue;
+      pt = (pte_t *)P2V(PTE_ADDR(pgdir[i]));
+      for(j = 0; j < NPTENTRIES && count > 0; j++){
+        if(victim_ok(pt[j])){
+          pt[j] &= ~PTE_A;
+          count--;
         }
-        if (flag == 1)
-            break;
+      }
     }
-  cprintf("Victim page found after removing 10 percent\n");
-  return find_victim_page(victim_proc);
+  }
+  return (void *)-1;
 }
\ No newline at end of file
@@ -8,6 +8,7 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  pde_t * volatile pgdir;      // User page table in %cr3, or null
 };
 
 extern struct cpu cpus[NCPU];
@@ -35,9 +36,23 @@ struct context {
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
+#define NVMA 4  // file-backed regions per process
+
+// A region of user memory backed by a file: the loaded segments of the
+// program. Pages are read from the file on first touch, and past filesz
+// (the bss) they are zero-filled.
+struct vma {
+  uint start;           // page-aligned
+  uint end;
+  struct inode *ip;     // 0 if this slot is unused
+  uint off;             // file offset of start
+  uint filesz;          // bytes of file data from start
+};
+
 struct proc {
   uint sz;
   uint rss;                     // Size of process memory (bytes)
+  int heapmode;                // How sbrk backs new pages (HEAP_*)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
@@ -49,6 +64,10 @@ struct proc {
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
+  struct vma vma[NVMA];        // File-backed memory
+  uint ra_va;                  // Start of the last swap read-ahead batch
+  int ra_n;                    // Pages in it
+  int ra_window;               // Pages to read ahead on the next swap fault
   char name[16];               // Process name (debugging)
 };
 
@@ -0,0 +1,1326 @@
+
+_rmapbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return degree == 1 || (i == degree - 2 && pid > 0) ? 0 : -1;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  int d;
+
+  for(d = 1; ; d *= 2){
+  14:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  1f:	90                   	nop
+    if(d > NPROC - 4)
+  20:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  23:	b8 3c 00 00 00       	mov    $0x3c,%eax
+  28:	39 c3                	cmp    %eax,%ebx
+  2a:	0f 4e c3             	cmovle %ebx,%eax
+  if(pipe(fds) < 0)
+  2d:	83 ec 0c             	sub    $0xc,%esp
+    if(d > NPROC - 4)
+  30:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(pipe(fds) < 0)
+  33:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  36:	50                   	push   %eax
+  37:	e8 17 04 00 00       	call   453 <pipe>
+  3c:	83 c4 10             	add    $0x10,%esp
+  3f:	85 c0                	test   %eax,%eax
+  41:	0f 88 35 01 00 00    	js     17c <main+0x17c>
+  base = sbrk(NPAGES * 4096);
+  47:	83 ec 0c             	sub    $0xc,%esp
+  4a:	68 00 00 04 00       	push   $0x40000
+  4f:	e8 77 04 00 00       	call   4cb <sbrk>
+  54:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NPAGES; i++)
+  57:	31 d2                	xor    %edx,%edx
+  59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    base[i * 4096] = i;
+  60:	89 d1                	mov    %edx,%ecx
+  62:	c1 e1 0c             	shl    $0xc,%ecx
+  65:	88 14 08             	mov    %dl,(%eax,%ecx,1)
+  for(i = 0; i < NPAGES; i++)
+  68:	83 c2 01             	add    $0x1,%edx
+  6b:	83 fa 40             	cmp    $0x40,%edx
+  6e:	75 f0                	jne    60 <main+0x60>
+  for(i = 0; i < degree - 2; i++){
+  70:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  73:	31 ff                	xor    %edi,%edi
+  75:	8d 70 fe             	lea    -0x2(%eax),%esi
+  78:	85 f6                	test   %esi,%esi
+  7a:	7f 19                	jg     95 <main+0x95>
+  7c:	e9 13 01 00 00       	jmp    194 <main+0x194>
+  81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pid == 0){
+  88:	0f 84 1c 01 00 00    	je     1aa <main+0x1aa>
+  for(i = 0; i < degree - 2; i++){
+  8e:	83 c7 01             	add    $0x1,%edi
+  91:	39 f7                	cmp    %esi,%edi
+  93:	74 7a                	je     10f <main+0x10f>
+    if((pid = fork()) < 0)
+  95:	e8 a1 03 00 00       	call   43b <fork>
+  9a:	85 c0                	test   %eax,%eax
+  9c:	79 ea                	jns    88 <main+0x88>
+  if(degree == 1)
+  9e:	83 7d d4 01          	cmpl   $0x1,-0x2c(%ebp)
+  a2:	89 c3                	mov    %eax,%ebx
+  a4:	0f 84 8b 00 00 00    	je     135 <main+0x135>
+  else if(i == degree - 2 && (pid = fork()) == 0){
+  aa:	39 fe                	cmp    %edi,%esi
+  ac:	74 69                	je     117 <main+0x117>
+  close(fds[0]);
+  ae:	83 ec 0c             	sub    $0xc,%esp
+  b1:	ff 75 e0             	push   -0x20(%ebp)
+  b4:	e8 b2 03 00 00       	call   46b <close>
+  close(fds[1]);
+  b9:	58                   	pop    %eax
+  ba:	ff 75 e4             	push   -0x1c(%ebp)
+  bd:	e8 a9 03 00 00       	call   46b <close>
+    sbrk(-NPAGES * 4096);
+  c2:	c7 04 24 00 00 fc ff 	movl   $0xfffc0000,(%esp)
+  c9:	e8 fd 03 00 00       	call   4cb <sbrk>
+  ce:	83 c4 10             	add    $0x10,%esp
+  d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while(wait() >= 0)
+  d8:	e8 6e 03 00 00       	call   44b <wait>
+  dd:	85 c0                	test   %eax,%eax
+  df:	79 f7                	jns    d8 <main+0xd8>
+  return degree == 1 || (i == degree - 2 && pid > 0) ? 0 : -1;
+  e1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  e4:	83 f8 01             	cmp    $0x1,%eax
+  e7:	74 19                	je     102 <main+0x102>
+  e9:	39 fe                	cmp    %edi,%esi
+  eb:	0f 85 8b 00 00 00    	jne    17c <main+0x17c>
+  f1:	85 db                	test   %ebx,%ebx
+  f3:	0f 8e 83 00 00 00    	jle    17c <main+0x17c>
+      d = NPROC - 4;
+    if(run(d) < 0){
+      printf(1, "fork failed at degree %d\n", d);
+      break;
+    }
+    if(d == NPROC - 4)
+  f9:	83 f8 3b             	cmp    $0x3b,%eax
+  fc:	0f 8f 8d 00 00 00    	jg     18f <main+0x18f>
+  for(d = 1; ; d *= 2){
+ 102:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 105:	01 c0                	add    %eax,%eax
+ 107:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    if(d > NPROC - 4)
+ 10a:	e9 11 ff ff ff       	jmp    20 <main+0x20>
+  if(degree == 1)
+ 10f:	83 7d d4 01          	cmpl   $0x1,-0x2c(%ebp)
+ 113:	89 c3                	mov    %eax,%ebx
+ 115:	74 1e                	je     135 <main+0x135>
+  else if(i == degree - 2 && (pid = fork()) == 0){
+ 117:	e8 1f 03 00 00       	call   43b <fork>
+ 11c:	89 c3                	mov    %eax,%ebx
+ 11e:	85 c0                	test   %eax,%eax
+ 120:	0f 84 a5 00 00 00    	je     1cb <main+0x1cb>
+  } else if(pid > 0)
+ 126:	7e 86                	jle    ae <main+0xae>
+    wait();  // the holders are blocked, so this is the timing child
+ 128:	e8 1e 03 00 00       	call   44b <wait>
+ 12d:	e9 7c ff ff ff       	jmp    ae <main+0xae>
+  int fds[2], i, pid = -1;
+ 132:	83 cb ff             	or     $0xffffffff,%ebx
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 135:	0f 31                	rdtsc
+  sbrk(-NPAGES * 4096);
+ 137:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 13a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  sbrk(-NPAGES * 4096);
+ 13d:	68 00 00 fc ff       	push   $0xfffc0000
+ 142:	e8 84 03 00 00       	call   4cb <sbrk>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 147:	0f 31                	rdtsc
+  printf(1, "degree %d: %d cycles/page\n", degree, (t1 - t0) / NPAGES);
+ 149:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 14c:	29 d0                	sub    %edx,%eax
+ 14e:	c1 e8 06             	shr    $0x6,%eax
+ 151:	50                   	push   %eax
+ 152:	6a 01                	push   $0x1
+ 154:	68 f2 08 00 00       	push   $0x8f2
+ 159:	6a 01                	push   $0x1
+ 15b:	e8 50 04 00 00       	call   5b0 <printf>
+  close(fds[0]);
+ 160:	83 c4 14             	add    $0x14,%esp
+ 163:	ff 75 e0             	push   -0x20(%ebp)
+ 166:	e8 00 03 00 00       	call   46b <close>
+  close(fds[1]);
+ 16b:	5a                   	pop    %edx
+ 16c:	ff 75 e4             	push   -0x1c(%ebp)
+ 16f:	e8 f7 02 00 00       	call   46b <close>
+ 174:	83 c4 10             	add    $0x10,%esp
+ 177:	e9 5c ff ff ff       	jmp    d8 <main+0xd8>
+      printf(1, "fork failed at degree %d\n", d);
+ 17c:	51                   	push   %ecx
+ 17d:	ff 75 d0             	push   -0x30(%ebp)
+ 180:	68 d8 08 00 00       	push   $0x8d8
+ 185:	6a 01                	push   $0x1
+ 187:	e8 24 04 00 00       	call   5b0 <printf>
+      break;
+ 18c:	83 c4 10             	add    $0x10,%esp
+      break;
+  }
+  exit();
+ 18f:	e8 af 02 00 00       	call   443 <exit>
+  if(degree == 1)
+ 194:	83 7d d4 01          	cmpl   $0x1,-0x2c(%ebp)
+ 198:	74 98                	je     132 <main+0x132>
+  else if(i == degree - 2 && (pid = fork()) == 0){
+ 19a:	85 f6                	test   %esi,%esi
+ 19c:	0f 84 75 ff ff ff    	je     117 <main+0x117>
+  int fds[2], i, pid = -1;
+ 1a2:	83 cb ff             	or     $0xffffffff,%ebx
+ 1a5:	e9 04 ff ff ff       	jmp    ae <main+0xae>
+      close(fds[1]);
+ 1aa:	83 ec 0c             	sub    $0xc,%esp
+ 1ad:	ff 75 e4             	push   -0x1c(%ebp)
+ 1b0:	e8 b6 02 00 00       	call   46b <close>
+      read(fds[0], &c, 1);
+ 1b5:	83 c4 0c             	add    $0xc,%esp
+ 1b8:	8d 45 df             	lea    -0x21(%ebp),%eax
+ 1bb:	6a 01                	push   $0x1
+ 1bd:	50                   	push   %eax
+ 1be:	ff 75 e0             	push   -0x20(%ebp)
+ 1c1:	e8 95 02 00 00       	call   45b <read>
+      exit();
+ 1c6:	e8 78 02 00 00       	call   443 <exit>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 1cb:	0f 31                	rdtsc
+  sbrk(-NPAGES * 4096);
+ 1cd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 1d0:	89 c3                	mov    %eax,%ebx
+  sbrk(-NPAGES * 4096);
+ 1d2:	68 00 00 fc ff       	push   $0xfffc0000
+ 1d7:	e8 ef 02 00 00       	call   4cb <sbrk>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 1dc:	0f 31                	rdtsc
+  printf(1, "degree %d: %d cycles/page\n", degree, (t1 - t0) / NPAGES);
+ 1de:	29 d8                	sub    %ebx,%eax
+ 1e0:	c1 e8 06             	shr    $0x6,%eax
+ 1e3:	50                   	push   %eax
+ 1e4:	ff 75 d0             	push   -0x30(%ebp)
+ 1e7:	68 f2 08 00 00       	push   $0x8f2
+ 1ec:	6a 01                	push   $0x1
+ 1ee:	e8 bd 03 00 00       	call   5b0 <printf>
+    exit();
+ 1f3:	83 c4 20             	add    $0x20,%esp
+ 1f6:	e8 48 02 00 00       	call   443 <exit>
+ 1fb:	66 90                	xchg   %ax,%ax
+ 1fd:	66 90                	xchg   %ax,%ax
+ 1ff:	90                   	nop
+
+00000200 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 200:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 201:	31 c0                	xor    %eax,%eax
+{
+ 203:	89 e5                	mov    %esp,%ebp
+ 205:	53                   	push   %ebx
+ 206:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 209:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 210:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 214:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 217:	83 c0 01             	add    $0x1,%eax
+ 21a:	84 d2                	test   %dl,%dl
+ 21c:	75 f2                	jne    210 <strcpy+0x10>
+    ;
+  return os;
+}
+ 21e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 221:	89 c8                	mov    %ecx,%eax
+ 223:	c9                   	leave
+ 224:	c3                   	ret
+ 225:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+ 237:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 23a:	0f b6 02             	movzbl (%edx),%eax
+ 23d:	84 c0                	test   %al,%al
+ 23f:	75 17                	jne    258 <strcmp+0x28>
+ 241:	eb 3a                	jmp    27d <strcmp+0x4d>
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 24c:	83 c2 01             	add    $0x1,%edx
+ 24f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 252:	84 c0                	test   %al,%al
+ 254:	74 1a                	je     270 <strcmp+0x40>
+    p++, q++;
+ 256:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 258:	0f b6 19             	movzbl (%ecx),%ebx
+ 25b:	38 c3                	cmp    %al,%bl
+ 25d:	74 e9                	je     248 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 25f:	29 d8                	sub    %ebx,%eax
+}
+ 261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 264:	c9                   	leave
+ 265:	c3                   	ret
+ 266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 270:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 274:	31 c0                	xor    %eax,%eax
+ 276:	29 d8                	sub    %ebx,%eax
+}
+ 278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 27b:	c9                   	leave
+ 27c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 27d:	0f b6 19             	movzbl (%ecx),%ebx
+ 280:	31 c0                	xor    %eax,%eax
+ 282:	eb db                	jmp    25f <strcmp+0x2f>
+ 284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+
+00000290 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 296:	80 3a 00             	cmpb   $0x0,(%edx)
+ 299:	74 15                	je     2b0 <strlen+0x20>
+ 29b:	31 c0                	xor    %eax,%eax
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+ 2a0:	83 c0 01             	add    $0x1,%eax
+ 2a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2a7:	89 c1                	mov    %eax,%ecx
+ 2a9:	75 f5                	jne    2a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2ab:	89 c8                	mov    %ecx,%eax
+ 2ad:	5d                   	pop    %ebp
+ 2ae:	c3                   	ret
+ 2af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2b0:	31 c9                	xor    %ecx,%ecx
+}
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	89 c8                	mov    %ecx,%eax
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2cd:	89 d7                	mov    %edx,%edi
+ 2cf:	fc                   	cld
+ 2d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2d5:	89 d0                	mov    %edx,%eax
+ 2d7:	c9                   	leave
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ea:	0f b6 10             	movzbl (%eax),%edx
+ 2ed:	84 d2                	test   %dl,%dl
+ 2ef:	75 12                	jne    303 <strchr+0x23>
+ 2f1:	eb 1d                	jmp    310 <strchr+0x30>
+ 2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2f7:	90                   	nop
+ 2f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2fc:	83 c0 01             	add    $0x1,%eax
+ 2ff:	84 d2                	test   %dl,%dl
+ 301:	74 0d                	je     310 <strchr+0x30>
+    if(*s == c)
+ 303:	38 d1                	cmp    %dl,%cl
+ 305:	75 f1                	jne    2f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 307:	5d                   	pop    %ebp
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 310:	31 c0                	xor    %eax,%eax
+}
+ 312:	5d                   	pop    %ebp
+ 313:	c3                   	ret
+ 314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 325:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 328:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 329:	31 db                	xor    %ebx,%ebx
+{
+ 32b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 32e:	eb 27                	jmp    357 <gets+0x37>
+    cc = read(0, &c, 1);
+ 330:	83 ec 04             	sub    $0x4,%esp
+ 333:	6a 01                	push   $0x1
+ 335:	56                   	push   %esi
+ 336:	6a 00                	push   $0x0
+ 338:	e8 1e 01 00 00       	call   45b <read>
+    if(cc < 1)
+ 33d:	83 c4 10             	add    $0x10,%esp
+ 340:	85 c0                	test   %eax,%eax
+ 342:	7e 1d                	jle    361 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 344:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 348:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 34f:	3c 0a                	cmp    $0xa,%al
+ 351:	74 10                	je     363 <gets+0x43>
+ 353:	3c 0d                	cmp    $0xd,%al
+ 355:	74 0c                	je     363 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 357:	89 df                	mov    %ebx,%edi
+ 359:	83 c3 01             	add    $0x1,%ebx
+ 35c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 35f:	7c cf                	jl     330 <gets+0x10>
+ 361:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 36a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 36d:	5b                   	pop    %ebx
+ 36e:	5e                   	pop    %esi
+ 36f:	5f                   	pop    %edi
+ 370:	5d                   	pop    %ebp
+ 371:	c3                   	ret
+ 372:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	56                   	push   %esi
+ 384:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 385:	83 ec 08             	sub    $0x8,%esp
+ 388:	6a 00                	push   $0x0
+ 38a:	ff 75 08             	push   0x8(%ebp)
+ 38d:	e8 f1 00 00 00       	call   483 <open>
+  if(fd < 0)
+ 392:	83 c4 10             	add    $0x10,%esp
+ 395:	85 c0                	test   %eax,%eax
+ 397:	78 27                	js     3c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 399:	83 ec 08             	sub    $0x8,%esp
+ 39c:	ff 75 0c             	push   0xc(%ebp)
+ 39f:	89 c3                	mov    %eax,%ebx
+ 3a1:	50                   	push   %eax
+ 3a2:	e8 f4 00 00 00       	call   49b <fstat>
+  close(fd);
+ 3a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3ac:	e8 ba 00 00 00       	call   46b <close>
+  return r;
+ 3b1:	83 c4 10             	add    $0x10,%esp
+}
+ 3b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3b7:	89 f0                	mov    %esi,%eax
+ 3b9:	5b                   	pop    %ebx
+ 3ba:	5e                   	pop    %esi
+ 3bb:	5d                   	pop    %ebp
+ 3bc:	c3                   	ret
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3c5:	eb ed                	jmp    3b4 <stat+0x34>
+ 3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3d7:	0f be 02             	movsbl (%edx),%eax
+ 3da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3e5:	77 1e                	ja     405 <atoi+0x35>
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3f0:	83 c2 01             	add    $0x1,%edx
+ 3f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3fa:	0f be 02             	movsbl (%edx),%eax
+ 3fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 400:	80 fb 09             	cmp    $0x9,%bl
+ 403:	76 eb                	jbe    3f0 <atoi+0x20>
+  return n;
+}
+ 405:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 408:	89 c8                	mov    %ecx,%eax
+ 40a:	c9                   	leave
+ 40b:	c3                   	ret
+ 40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	8b 45 10             	mov    0x10(%ebp),%eax
+ 418:	8b 55 08             	mov    0x8(%ebp),%edx
+ 41b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 41e:	85 c0                	test   %eax,%eax
+ 420:	7e 13                	jle    435 <memmove+0x25>
+ 422:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 424:	89 d7                	mov    %edx,%edi
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 430:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 431:	39 f8                	cmp    %edi,%eax
+ 433:	75 fb                	jne    430 <memmove+0x20>
+  return vdst;
+}
+ 435:	5e                   	pop    %esi
+ 436:	89 d0                	mov    %edx,%eax
+ 438:	5f                   	pop    %edi
+ 439:	5d                   	pop    %ebp
+ 43a:	c3                   	ret
+
+0000043b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 43b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <exit>:
+SYSCALL(exit)
+ 443:	b8 02 00 00 00       	mov    $0x2,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <wait>:
+SYSCALL(wait)
+ 44b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <pipe>:
+SYSCALL(pipe)
+ 453:	b8 04 00 00 00       	mov    $0x4,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <read>:
+SYSCALL(read)
+ 45b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <write>:
+SYSCALL(write)
+ 463:	b8 10 00 00 00       	mov    $0x10,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <close>:
+SYSCALL(close)
+ 46b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <kill>:
+SYSCALL(kill)
+ 473:	b8 06 00 00 00       	mov    $0x6,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <exec>:
+SYSCALL(exec)
+ 47b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <open>:
+SYSCALL(open)
+ 483:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <mknod>:
+SYSCALL(mknod)
+ 48b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <unlink>:
+SYSCALL(unlink)
+ 493:	b8 12 00 00 00       	mov    $0x12,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <fstat>:
+SYSCALL(fstat)
+ 49b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <link>:
+SYSCALL(link)
+ 4a3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <mkdir>:
+SYSCALL(mkdir)
+ 4ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <chdir>:
+SYSCALL(chdir)
+ 4b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <dup>:
+SYSCALL(dup)
+ 4bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <getpid>:
+SYSCALL(getpid)
+ 4c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <sbrk>:
+SYSCALL(sbrk)
+ 4cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <sleep>:
+SYSCALL(sleep)
+ 4d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <uptime>:
+SYSCALL(uptime)
+ 4db:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <getrss>:
+SYSCALL(getrss)
+ 4e3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ 4eb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getvmstat>:
+SYSCALL(getvmstat)
+ 4f3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <vmctl>:
+SYSCALL(vmctl)
+ 4fb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <spawn>:
+SYSCALL(spawn)
+ 503:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+ 50b:	66 90                	xchg   %ax,%ax
+ 50d:	66 90                	xchg   %ax,%ax
+ 50f:	90                   	nop
+
+00000510 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	53                   	push   %ebx
+ 516:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 518:	89 d1                	mov    %edx,%ecx
+{
+ 51a:	83 ec 3c             	sub    $0x3c,%esp
+ 51d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 520:	85 d2                	test   %edx,%edx
+ 522:	0f 89 80 00 00 00    	jns    5a8 <printint+0x98>
+ 528:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 52c:	74 7a                	je     5a8 <printint+0x98>
+    x = -xx;
+ 52e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 530:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 535:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 538:	31 f6                	xor    %esi,%esi
+ 53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 540:	89 c8                	mov    %ecx,%eax
+ 542:	31 d2                	xor    %edx,%edx
+ 544:	89 f7                	mov    %esi,%edi
+ 546:	f7 f3                	div    %ebx
+ 548:	8d 76 01             	lea    0x1(%esi),%esi
+ 54b:	0f b6 92 6c 09 00 00 	movzbl 0x96c(%edx),%edx
+ 552:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 556:	89 ca                	mov    %ecx,%edx
+ 558:	89 c1                	mov    %eax,%ecx
+ 55a:	39 da                	cmp    %ebx,%edx
+ 55c:	73 e2                	jae    540 <printint+0x30>
+  if(neg)
+ 55e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 561:	85 c0                	test   %eax,%eax
+ 563:	74 07                	je     56c <printint+0x5c>
+    buf[i++] = '-';
+ 565:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 56a:	89 f7                	mov    %esi,%edi
+ 56c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 56f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 572:	01 df                	add    %ebx,%edi
+ 574:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 578:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 57b:	83 ec 04             	sub    $0x4,%esp
+ 57e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 581:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 584:	6a 01                	push   $0x1
+ 586:	50                   	push   %eax
+ 587:	56                   	push   %esi
+ 588:	e8 d6 fe ff ff       	call   463 <write>
+  while(--i >= 0)
+ 58d:	89 f8                	mov    %edi,%eax
+ 58f:	83 c4 10             	add    $0x10,%esp
+ 592:	83 ef 01             	sub    $0x1,%edi
+ 595:	39 d8                	cmp    %ebx,%eax
+ 597:	75 df                	jne    578 <printint+0x68>
+}
+ 599:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 59c:	5b                   	pop    %ebx
+ 59d:	5e                   	pop    %esi
+ 59e:	5f                   	pop    %edi
+ 59f:	5d                   	pop    %ebp
+ 5a0:	c3                   	ret
+ 5a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5a8:	31 c0                	xor    %eax,%eax
+ 5aa:	eb 89                	jmp    535 <printint+0x25>
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 5c2:	83 c6 01             	add    $0x1,%esi
+ 5c5:	84 db                	test   %bl,%bl
+ 5c7:	74 67                	je     630 <printf+0x80>
+ 5c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5cc:	31 d2                	xor    %edx,%edx
+ 5ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5d1:	eb 34                	jmp    607 <printf+0x57>
+ 5d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5d7:	90                   	nop
+ 5d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5e0:	83 f8 25             	cmp    $0x25,%eax
+ 5e3:	74 18                	je     5fd <printf+0x4d>
+  write(fd, &c, 1);
+ 5e5:	83 ec 04             	sub    $0x4,%esp
+ 5e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ee:	6a 01                	push   $0x1
+ 5f0:	50                   	push   %eax
+ 5f1:	57                   	push   %edi
+ 5f2:	e8 6c fe ff ff       	call   463 <write>
+ 5f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 600:	83 c6 01             	add    $0x1,%esi
+ 603:	84 db                	test   %bl,%bl
+ 605:	74 29                	je     630 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 607:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 60a:	85 d2                	test   %edx,%edx
+ 60c:	74 ca                	je     5d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 60e:	83 fa 25             	cmp    $0x25,%edx
+ 611:	75 ea                	jne    5fd <printf+0x4d>
+      if(c == 'd'){
+ 613:	83 f8 25             	cmp    $0x25,%eax
+ 616:	0f 84 24 01 00 00    	je     740 <printf+0x190>
+ 61c:	83 e8 63             	sub    $0x63,%eax
+ 61f:	83 f8 15             	cmp    $0x15,%eax
+ 622:	77 1c                	ja     640 <printf+0x90>
+ 624:	ff 24 85 14 09 00 00 	jmp    *0x914(,%eax,4)
+ 62b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 62f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 630:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 633:	5b                   	pop    %ebx
+ 634:	5e                   	pop    %esi
+ 635:	5f                   	pop    %edi
+ 636:	5d                   	pop    %ebp
+ 637:	c3                   	ret
+ 638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+  write(fd, &c, 1);
+ 640:	83 ec 04             	sub    $0x4,%esp
+ 643:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 646:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 64a:	6a 01                	push   $0x1
+ 64c:	52                   	push   %edx
+ 64d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 650:	57                   	push   %edi
+ 651:	e8 0d fe ff ff       	call   463 <write>
+ 656:	83 c4 0c             	add    $0xc,%esp
+ 659:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 65c:	6a 01                	push   $0x1
+ 65e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 661:	52                   	push   %edx
+ 662:	57                   	push   %edi
+ 663:	e8 fb fd ff ff       	call   463 <write>
+        putc(fd, c);
+ 668:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 66b:	31 d2                	xor    %edx,%edx
+ 66d:	eb 8e                	jmp    5fd <printf+0x4d>
+ 66f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 670:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 673:	83 ec 0c             	sub    $0xc,%esp
+ 676:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 67b:	8b 13                	mov    (%ebx),%edx
+ 67d:	6a 00                	push   $0x0
+ 67f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 681:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 684:	e8 87 fe ff ff       	call   510 <printint>
+        ap++;
+ 689:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 68c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 68f:	31 d2                	xor    %edx,%edx
+ 691:	e9 67 ff ff ff       	jmp    5fd <printf+0x4d>
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6a5:	83 c0 04             	add    $0x4,%eax
+ 6a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6ab:	85 db                	test   %ebx,%ebx
+ 6ad:	0f 84 9d 00 00 00    	je     750 <printf+0x1a0>
+        while(*s != 0){
+ 6b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6b8:	84 c0                	test   %al,%al
+ 6ba:	0f 84 3d ff ff ff    	je     5fd <printf+0x4d>
+ 6c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6c6:	89 de                	mov    %ebx,%esi
+ 6c8:	89 d3                	mov    %edx,%ebx
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6d9:	6a 01                	push   $0x1
+ 6db:	53                   	push   %ebx
+ 6dc:	57                   	push   %edi
+ 6dd:	e8 81 fd ff ff       	call   463 <write>
+        while(*s != 0){
+ 6e2:	0f b6 06             	movzbl (%esi),%eax
+ 6e5:	83 c4 10             	add    $0x10,%esp
+ 6e8:	84 c0                	test   %al,%al
+ 6ea:	75 e4                	jne    6d0 <printf+0x120>
+      state = 0;
+ 6ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6ef:	31 d2                	xor    %edx,%edx
+ 6f1:	e9 07 ff ff ff       	jmp    5fd <printf+0x4d>
+ 6f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 700:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 703:	83 ec 0c             	sub    $0xc,%esp
+ 706:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 70b:	8b 13                	mov    (%ebx),%edx
+ 70d:	6a 01                	push   $0x1
+ 70f:	e9 6b ff ff ff       	jmp    67f <printf+0xcf>
+ 714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 718:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 71b:	83 ec 04             	sub    $0x4,%esp
+ 71e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 721:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 723:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 726:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 729:	6a 01                	push   $0x1
+ 72b:	52                   	push   %edx
+ 72c:	57                   	push   %edi
+ 72d:	e8 31 fd ff ff       	call   463 <write>
+        ap++;
+ 732:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 735:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 738:	31 d2                	xor    %edx,%edx
+ 73a:	e9 be fe ff ff       	jmp    5fd <printf+0x4d>
+ 73f:	90                   	nop
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 746:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 749:	6a 01                	push   $0x1
+ 74b:	e9 11 ff ff ff       	jmp    661 <printf+0xb1>
+ 750:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 755:	bb 0d 09 00 00       	mov    $0x90d,%ebx
+ 75a:	e9 61 ff ff ff       	jmp    6c0 <printf+0x110>
+ 75f:	90                   	nop
+
+00000760 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 760:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 761:	a1 14 0c 00 00       	mov    0xc14,%eax
+{
+ 766:	89 e5                	mov    %esp,%ebp
+ 768:	57                   	push   %edi
+ 769:	56                   	push   %esi
+ 76a:	53                   	push   %ebx
+ 76b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 76e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 778:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 77a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 77c:	39 ca                	cmp    %ecx,%edx
+ 77e:	73 30                	jae    7b0 <free+0x50>
+ 780:	39 c1                	cmp    %eax,%ecx
+ 782:	72 04                	jb     788 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 784:	39 c2                	cmp    %eax,%edx
+ 786:	72 f0                	jb     778 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 788:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 78b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 78e:	39 f8                	cmp    %edi,%eax
+ 790:	74 2e                	je     7c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 792:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 795:	8b 42 04             	mov    0x4(%edx),%eax
+ 798:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 79b:	39 f1                	cmp    %esi,%ecx
+ 79d:	74 38                	je     7d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 79f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7a1:	5b                   	pop    %ebx
+  freep = p;
+ 7a2:	89 15 14 0c 00 00    	mov    %edx,0xc14
+}
+ 7a8:	5e                   	pop    %esi
+ 7a9:	5f                   	pop    %edi
+ 7aa:	5d                   	pop    %ebp
+ 7ab:	c3                   	ret
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7b0:	39 c1                	cmp    %eax,%ecx
+ 7b2:	72 d0                	jb     784 <free+0x24>
+ 7b4:	eb c2                	jmp    778 <free+0x18>
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7c0:	03 70 04             	add    0x4(%eax),%esi
+ 7c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7c6:	8b 02                	mov    (%edx),%eax
+ 7c8:	8b 00                	mov    (%eax),%eax
+ 7ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 7d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7d3:	39 f1                	cmp    %esi,%ecx
+ 7d5:	75 c8                	jne    79f <free+0x3f>
+    p->s.size += bp->s.size;
+ 7d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7da:	89 15 14 0c 00 00    	mov    %edx,0xc14
+    p->s.size += bp->s.size;
+ 7e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7e8:	5b                   	pop    %ebx
+ 7e9:	5e                   	pop    %esi
+ 7ea:	5f                   	pop    %edi
+ 7eb:	5d                   	pop    %ebp
+ 7ec:	c3                   	ret
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 7fc:	8b 15 14 0c 00 00    	mov    0xc14,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 802:	8d 78 07             	lea    0x7(%eax),%edi
+ 805:	c1 ef 03             	shr    $0x3,%edi
+ 808:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 80b:	85 d2                	test   %edx,%edx
+ 80d:	0f 84 8d 00 00 00    	je     8a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 813:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 815:	8b 48 04             	mov    0x4(%eax),%ecx
+ 818:	39 f9                	cmp    %edi,%ecx
+ 81a:	73 64                	jae    880 <malloc+0x90>
+  if(nu < 4096)
+ 81c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 821:	39 df                	cmp    %ebx,%edi
+ 823:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 826:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 82d:	eb 0a                	jmp    839 <malloc+0x49>
+ 82f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 830:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 832:	8b 48 04             	mov    0x4(%eax),%ecx
+ 835:	39 f9                	cmp    %edi,%ecx
+ 837:	73 47                	jae    880 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 839:	89 c2                	mov    %eax,%edx
+ 83b:	39 05 14 0c 00 00    	cmp    %eax,0xc14
+ 841:	75 ed                	jne    830 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 843:	83 ec 0c             	sub    $0xc,%esp
+ 846:	56                   	push   %esi
+ 847:	e8 7f fc ff ff       	call   4cb <sbrk>
+  if(p == (char*)-1)
+ 84c:	83 c4 10             	add    $0x10,%esp
+ 84f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 852:	74 1c                	je     870 <malloc+0x80>
+  hp->s.size = nu;
+ 854:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 857:	83 ec 0c             	sub    $0xc,%esp
+ 85a:	83 c0 08             	add    $0x8,%eax
+ 85d:	50                   	push   %eax
+ 85e:	e8 fd fe ff ff       	call   760 <free>
+  return freep;
+ 863:	8b 15 14 0c 00 00    	mov    0xc14,%edx
+      if((p = morecore(nunits)) == 0)
+ 869:	83 c4 10             	add    $0x10,%esp
+ 86c:	85 d2                	test   %edx,%edx
+ 86e:	75 c0                	jne    830 <malloc+0x40>
+        return 0;
+  }
+}
+ 870:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 873:	31 c0                	xor    %eax,%eax
+}
+ 875:	5b                   	pop    %ebx
+ 876:	5e                   	pop    %esi
+ 877:	5f                   	pop    %edi
+ 878:	5d                   	pop    %ebp
+ 879:	c3                   	ret
+ 87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 880:	39 cf                	cmp    %ecx,%edi
+ 882:	74 4c                	je     8d0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 884:	29 f9                	sub    %edi,%ecx
+ 886:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 889:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 88c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 88f:	89 15 14 0c 00 00    	mov    %edx,0xc14
+}
+ 895:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 898:	83 c0 08             	add    $0x8,%eax
+}
+ 89b:	5b                   	pop    %ebx
+ 89c:	5e                   	pop    %esi
+ 89d:	5f                   	pop    %edi
+ 89e:	5d                   	pop    %ebp
+ 89f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8a0:	c7 05 14 0c 00 00 18 	movl   $0xc18,0xc14
+ 8a7:	0c 00 00 
+    base.s.size = 0;
+ 8aa:	b8 18 0c 00 00       	mov    $0xc18,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8af:	c7 05 18 0c 00 00 18 	movl   $0xc18,0xc18
+ 8b6:	0c 00 00 
+    base.s.size = 0;
+ 8b9:	c7 05 1c 0c 00 00 00 	movl   $0x0,0xc1c
+ 8c0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8c3:	e9 54 ff ff ff       	jmp    81c <malloc+0x2c>
+ 8c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8d0:	8b 08                	mov    (%eax),%ecx
+ 8d2:	89 0a                	mov    %ecx,(%edx)
+ 8d4:	eb b9                	jmp    88f <malloc+0x9f>
@@ -0,0 +1,107 @@
+// Reverse-map microbenchmark.
+// For growing sharing degrees d, fork d-1 children that keep a heap
+// region COW-shared, then time how long the parent, the pages' oldest
+// mapper, takes to unmap the region with sbrk(-n). Every process first
+// writes to a page of its own next to the region, so that it has a
+// private copy of the page table: the unmap then drops one rmap entry
+// per page instead of a reference to a shared table. The per-page cost
+// should stay flat as d grows.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+
+#define NPAGES 64
+#define PTSPAN (1024 * 4096)  // bytes mapped by one page-table page
+
+static uint
+rdtsc(void)
+{
+  uint lo, hi;
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return lo;
+}
+
+static void
+timeunmap(int degree)
+{
+  uint t0, t1;
+
+  t0 = rdtsc();
+  sbrk(-NPAGES * 4096);
+  t1 = rdtsc();
+  printf(1, "degree %d: %d cycles/page\n", degree, (t1 - t0) / NPAGES);
+}
+
+static int
+run(int degree)
+{
+  int go[2], ready[2], i, n, pad;
+  char *base, c;
+
+  if(pipe(go) < 0)
+    return -1;
+  if(pipe(ready) < 0){
+    close(go[0]);
+    close(go[1]);
+    return -1;
+  }
+  // Start the region at a page-table boundary so that one table maps it
+  // all, with its first page for the private writes.
+  pad = (PTSPAN - (uint)sbrk(0) % PTSPAN) % PTSPAN;
+  sbrk(pad);
+  base = sbrk((NPAGES + 1) * 4096);
+  for(i = 1; i <= NPAGES; i++)
+    base[i * 4096] = i;
+
+  // Holders: unshare their page table, then keep the pages shared until
+  // the go pipe is closed.
+  for(n = 0; n < degree - 1; n++){
+    if((i = fork()) < 0)
+      break;
+    if(i == 0){
+      close(go[1]);
+      close(ready[0]);
+      base[0] = 1;
+      write(ready[1], "x", 1);
+      read(go[0], &c, 1);
+      exit();
+    }
+  }
+  close(go[0]);
+  close(ready[1]);
+  for(i = 0; i < n; i++)
+    read(ready[0], &c, 1);
+  close(ready[0]);
+  if(n == degree - 1){
+    // Last to write, the parent keeps the original table and so the
+    // oldest mapping of every page.
+    base[0] = 1;
+    timeunmap(degree);
+  } else
+    sbrk(-NPAGES * 4096);
+  close(go[1]);
+  sbrk(-(pad + 4096));
+  while(wait() >= 0)
+    ;
+  return n == degree - 1 ? 0 : -1;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int d;
+
+  for(d = 1; ; d *= 2){
+    if(d > NPROC - 4)
+      d = NPROC - 4;
+    if(run(d) < 0){
+      printf(1, "fork failed at degree %d\n", d);
+      break;
+    }
+    if(d == NPROC - 4)
+      break;
+  }
+  exit();
+}
@@ -0,0 +1,3023 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  static char buf[100];
+  struct cmd *cmd;
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+       f:	eb 10                	jmp    21 <main+0x21>
+      11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f bc 00 00 00    	jg     dd <main+0xdd>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 d9 15 00 00       	push   $0x15d9
+      2b:	e8 b3 10 00 00       	call   10e3 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	eb 4b                	jmp    84 <main+0x84>
+      39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      40:	80 3d c2 1c 00 00 20 	cmpb   $0x20,0x1cc2
+      47:	0f 84 9e 00 00 00    	je     eb <main+0xeb>
+      4d:	8d 76 00             	lea    0x0(%esi),%esi
+      buf[strlen(buf)-1] = 0;  // chop \n
+      if(chdir(buf+3) < 0)
+        printf(2, "cannot cd %s\n", buf+3);
+      continue;
+    }
+    cmd = parsecmd(buf);
+      50:	83 ec 0c             	sub    $0xc,%esp
+      53:	68 c0 1c 00 00       	push   $0x1cc0
+      58:	e8 13 0d 00 00       	call   d70 <parsecmd>
+    if(startcmd(cmd, 0, 0) >= 0)
+      5d:	83 c4 0c             	add    $0xc,%esp
+      60:	6a 00                	push   $0x0
+    cmd = parsecmd(buf);
+      62:	89 c3                	mov    %eax,%ebx
+    if(startcmd(cmd, 0, 0) >= 0)
+      64:	6a 00                	push   $0x0
+      66:	50                   	push   %eax
+      67:	e8 24 01 00 00       	call   190 <startcmd>
+      6c:	83 c4 10             	add    $0x10,%esp
+      6f:	85 c0                	test   %eax,%eax
+      71:	78 05                	js     78 <main+0x78>
+      wait();
+      73:	e8 33 10 00 00       	call   10ab <wait>
+    freecmd(cmd);
+      78:	83 ec 0c             	sub    $0xc,%esp
+      7b:	53                   	push   %ebx
+      7c:	e8 5f 0d 00 00       	call   de0 <freecmd>
+      81:	83 c4 10             	add    $0x10,%esp
+  printf(2, "$ ");
+      84:	83 ec 08             	sub    $0x8,%esp
+      87:	68 38 15 00 00       	push   $0x1538
+      8c:	6a 02                	push   $0x2
+      8e:	e8 7d 11 00 00       	call   1210 <printf>
+  memset(buf, 0, nbuf);
+      93:	83 c4 0c             	add    $0xc,%esp
+      96:	6a 64                	push   $0x64
+      98:	6a 00                	push   $0x0
+      9a:	68 c0 1c 00 00       	push   $0x1cc0
+      9f:	e8 7c 0e 00 00       	call   f20 <memset>
+  gets(buf, nbuf);
+      a4:	58                   	pop    %eax
+      a5:	5a                   	pop    %edx
+      a6:	6a 64                	push   $0x64
+      a8:	68 c0 1c 00 00       	push   $0x1cc0
+      ad:	e8 ce 0e 00 00       	call   f80 <gets>
+  if(buf[0] == 0) // EOF
+      b2:	0f b6 05 c0 1c 00 00 	movzbl 0x1cc0,%eax
+      b9:	83 c4 10             	add    $0x10,%esp
+      bc:	84 c0                	test   %al,%al
+      be:	74 18                	je     d8 <main+0xd8>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      c0:	3c 63                	cmp    $0x63,%al
+      c2:	75 8c                	jne    50 <main+0x50>
+      c4:	80 3d c1 1c 00 00 64 	cmpb   $0x64,0x1cc1
+      cb:	75 83                	jne    50 <main+0x50>
+      cd:	e9 6e ff ff ff       	jmp    40 <main+0x40>
+      d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }
+  exit();
+      d8:	e8 c6 0f 00 00       	call   10a3 <exit>
+      close(fd);
+      dd:	83 ec 0c             	sub    $0xc,%esp
+      e0:	50                   	push   %eax
+      e1:	e8 e5 0f 00 00       	call   10cb <close>
+      break;
+      e6:	83 c4 10             	add    $0x10,%esp
+      e9:	eb 99                	jmp    84 <main+0x84>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      eb:	83 ec 0c             	sub    $0xc,%esp
+      ee:	68 c0 1c 00 00       	push   $0x1cc0
+      f3:	e8 f8 0d 00 00       	call   ef0 <strlen>
+      if(chdir(buf+3) < 0)
+      f8:	c7 04 24 c3 1c 00 00 	movl   $0x1cc3,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      ff:	c6 80 bf 1c 00 00 00 	movb   $0x0,0x1cbf(%eax)
+      if(chdir(buf+3) < 0)
+     106:	e8 08 10 00 00       	call   1113 <chdir>
+     10b:	83 c4 10             	add    $0x10,%esp
+     10e:	85 c0                	test   %eax,%eax
+     110:	0f 89 6e ff ff ff    	jns    84 <main+0x84>
+        printf(2, "cannot cd %s\n", buf+3);
+     116:	51                   	push   %ecx
+     117:	68 c3 1c 00 00       	push   $0x1cc3
+     11c:	68 e1 15 00 00       	push   $0x15e1
+     121:	6a 02                	push   $0x2
+     123:	e8 e8 10 00 00       	call   1210 <printf>
+     128:	83 c4 10             	add    $0x10,%esp
+     12b:	e9 54 ff ff ff       	jmp    84 <main+0x84>
+
+00000130 <getcmd>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	56                   	push   %esi
+     134:	53                   	push   %ebx
+     135:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     138:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     13b:	83 ec 08             	sub    $0x8,%esp
+     13e:	68 38 15 00 00       	push   $0x1538
+     143:	6a 02                	push   $0x2
+     145:	e8 c6 10 00 00       	call   1210 <printf>
+  memset(buf, 0, nbuf);
+     14a:	83 c4 0c             	add    $0xc,%esp
+     14d:	56                   	push   %esi
+     14e:	6a 00                	push   $0x0
+     150:	53                   	push   %ebx
+     151:	e8 ca 0d 00 00       	call   f20 <memset>
+  gets(buf, nbuf);
+     156:	58                   	pop    %eax
+     157:	5a                   	pop    %edx
+     158:	56                   	push   %esi
+     159:	53                   	push   %ebx
+     15a:	e8 21 0e 00 00       	call   f80 <gets>
+  if(buf[0] == 0) // EOF
+     15f:	83 c4 10             	add    $0x10,%esp
+     162:	80 3b 01             	cmpb   $0x1,(%ebx)
+     165:	19 c0                	sbb    %eax,%eax
+}
+     167:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     16a:	5b                   	pop    %ebx
+     16b:	5e                   	pop    %esi
+     16c:	5d                   	pop    %ebp
+     16d:	c3                   	ret
+     16e:	66 90                	xchg   %ax,%ax
+
+00000170 <panic>:
+}
+
+void
+panic(char *s)
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     176:	ff 75 08             	push   0x8(%ebp)
+     179:	68 d5 15 00 00       	push   $0x15d5
+     17e:	6a 02                	push   $0x2
+     180:	e8 8b 10 00 00       	call   1210 <printf>
+  exit();
+     185:	e8 19 0f 00 00       	call   10a3 <exit>
+     18a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000190 <startcmd>:
+// first. A plain command, after any redirections, is started with
+// spawn so the shell's memory is never copied; anything else needs a
+// forked copy of the shell to run it. Returns the child's pid, or -1.
+int
+startcmd(struct cmd *cmd, struct spawn_action *act, int nact)
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	57                   	push   %edi
+     194:	56                   	push   %esi
+     195:	53                   	push   %ebx
+     196:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+     19c:	8b 75 08             	mov    0x8(%ebp),%esi
+     19f:	8b 7d 10             	mov    0x10(%ebp),%edi
+     1a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct execcmd *ecmd;
+  int i, pid;
+
+  for(i = 0; i < nact; i++)
+    acts[i] = act[i];
+  while(cmd->type == REDIR && nact < SPAWN_MAXACT){
+     1a5:	8b 0e                	mov    (%esi),%ecx
+  for(i = 0; i < nact; i++)
+     1a7:	85 ff                	test   %edi,%edi
+     1a9:	0f 8e a1 01 00 00    	jle    350 <startcmd+0x1c0>
+     1af:	89 f8                	mov    %edi,%eax
+     1b1:	89 8d 60 ff ff ff    	mov    %ecx,-0xa0(%ebp)
+     1b7:	8d 9d 68 ff ff ff    	lea    -0x98(%ebp),%ebx
+     1bd:	c1 e0 04             	shl    $0x4,%eax
+     1c0:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+     1c6:	8b 8d 64 ff ff ff    	mov    -0x9c(%ebp),%ecx
+     1cc:	31 c0                	xor    %eax,%eax
+     1ce:	66 90                	xchg   %ax,%ax
+    acts[i] = act[i];
+     1d0:	8b 34 02             	mov    (%edx,%eax,1),%esi
+     1d3:	89 34 18             	mov    %esi,(%eax,%ebx,1)
+     1d6:	8b 74 02 04          	mov    0x4(%edx,%eax,1),%esi
+     1da:	89 74 18 04          	mov    %esi,0x4(%eax,%ebx,1)
+     1de:	8b 74 02 08          	mov    0x8(%edx,%eax,1),%esi
+     1e2:	89 74 18 08          	mov    %esi,0x8(%eax,%ebx,1)
+     1e6:	8b 74 02 0c          	mov    0xc(%edx,%eax,1),%esi
+  for(i = 0; i < nact; i++)
+     1ea:	83 c0 10             	add    $0x10,%eax
+    acts[i] = act[i];
+     1ed:	89 74 18 fc          	mov    %esi,-0x4(%eax,%ebx,1)
+  for(i = 0; i < nact; i++)
+     1f1:	39 c8                	cmp    %ecx,%eax
+     1f3:	75 db                	jne    1d0 <startcmd+0x40>
+     1f5:	8b 8d 60 ff ff ff    	mov    -0xa0(%ebp),%ecx
+     1fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  while(cmd->type == REDIR && nact < SPAWN_MAXACT){
+     1fe:	83 f9 02             	cmp    $0x2,%ecx
+     201:	75 42                	jne    245 <startcmd+0xb5>
+     203:	83 ff 08             	cmp    $0x8,%edi
+     206:	0f 84 58 01 00 00    	je     364 <startcmd+0x1d4>
+     20c:	89 f8                	mov    %edi,%eax
+     20e:	c1 e0 04             	shl    $0x4,%eax
+     211:	01 d8                	add    %ebx,%eax
+     213:	eb 0b                	jmp    220 <startcmd+0x90>
+     215:	8d 76 00             	lea    0x0(%esi),%esi
+     218:	83 c0 10             	add    $0x10,%eax
+     21b:	83 ff 08             	cmp    $0x8,%edi
+     21e:	74 35                	je     255 <startcmd+0xc5>
+    rcmd = (struct redircmd*)cmd;
+    acts[nact].type = SPAWN_OPEN;
+     220:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+    acts[nact].fd = rcmd->fd;
+     226:	8b 56 14             	mov    0x14(%esi),%edx
+    acts[nact].arg = rcmd->mode;
+    acts[nact].path = rcmd->file;
+    nact++;
+     229:	83 c7 01             	add    $0x1,%edi
+    acts[nact].fd = rcmd->fd;
+     22c:	89 50 04             	mov    %edx,0x4(%eax)
+    acts[nact].arg = rcmd->mode;
+     22f:	8b 56 10             	mov    0x10(%esi),%edx
+     232:	89 50 08             	mov    %edx,0x8(%eax)
+    acts[nact].path = rcmd->file;
+     235:	8b 56 08             	mov    0x8(%esi),%edx
+     238:	89 50 0c             	mov    %edx,0xc(%eax)
+    cmd = rcmd->cmd;
+     23b:	8b 76 04             	mov    0x4(%esi),%esi
+  while(cmd->type == REDIR && nact < SPAWN_MAXACT){
+     23e:	8b 0e                	mov    (%esi),%ecx
+     240:	83 f9 02             	cmp    $0x2,%ecx
+     243:	74 d3                	je     218 <startcmd+0x88>
+  }
+  ecmd = (struct execcmd*)cmd;
+  if(cmd->type == EXEC && ecmd->argv[0] != 0){
+     245:	83 f9 01             	cmp    $0x1,%ecx
+     248:	75 0b                	jne    255 <startcmd+0xc5>
+     24a:	8b 46 04             	mov    0x4(%esi),%eax
+     24d:	85 c0                	test   %eax,%eax
+     24f:	0f 85 bb 00 00 00    	jne    310 <startcmd+0x180>
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+     255:	e8 41 0e 00 00       	call   109b <fork>
+  if(pid == -1)
+     25a:	83 f8 ff             	cmp    $0xffffffff,%eax
+     25d:	0f 84 18 01 00 00    	je     37b <startcmd+0x1eb>
+  if((pid = fork1()) == 0){
+     263:	85 c0                	test   %eax,%eax
+     265:	75 66                	jne    2cd <startcmd+0x13d>
+    for(i = 0; i < nact; i++){
+     267:	8d 9d 68 ff ff ff    	lea    -0x98(%ebp),%ebx
+     26d:	85 ff                	test   %edi,%edi
+     26f:	7e 4e                	jle    2bf <startcmd+0x12f>
+     271:	31 c0                	xor    %eax,%eax
+     273:	89 75 08             	mov    %esi,0x8(%ebp)
+     276:	89 de                	mov    %ebx,%esi
+     278:	89 c3                	mov    %eax,%ebx
+     27a:	eb 13                	jmp    28f <startcmd+0xff>
+     27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      else if(acts[i].type == SPAWN_OPEN && open(acts[i].path, acts[i].arg) < 0){
+     280:	83 f8 01             	cmp    $0x1,%eax
+     283:	74 53                	je     2d8 <startcmd+0x148>
+    for(i = 0; i < nact; i++){
+     285:	83 c3 01             	add    $0x1,%ebx
+     288:	83 c6 10             	add    $0x10,%esi
+     28b:	39 fb                	cmp    %edi,%ebx
+     28d:	74 2d                	je     2bc <startcmd+0x12c>
+      close(acts[i].fd);
+     28f:	83 ec 0c             	sub    $0xc,%esp
+     292:	ff 76 04             	push   0x4(%esi)
+     295:	e8 31 0e 00 00       	call   10cb <close>
+      if(acts[i].type == SPAWN_DUP2)
+     29a:	8b 06                	mov    (%esi),%eax
+     29c:	83 c4 10             	add    $0x10,%esp
+     29f:	83 f8 02             	cmp    $0x2,%eax
+     2a2:	75 dc                	jne    280 <startcmd+0xf0>
+        dup(acts[i].arg);
+     2a4:	83 ec 0c             	sub    $0xc,%esp
+     2a7:	ff 76 08             	push   0x8(%esi)
+    for(i = 0; i < nact; i++){
+     2aa:	83 c3 01             	add    $0x1,%ebx
+     2ad:	83 c6 10             	add    $0x10,%esi
+        dup(acts[i].arg);
+     2b0:	e8 66 0e 00 00       	call   111b <dup>
+     2b5:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < nact; i++){
+     2b8:	39 fb                	cmp    %edi,%ebx
+     2ba:	75 d3                	jne    28f <startcmd+0xff>
+     2bc:	8b 75 08             	mov    0x8(%ebp),%esi
+    runcmd(cmd);
+     2bf:	83 ec 0c             	sub    $0xc,%esp
+     2c2:	56                   	push   %esi
+     2c3:	e8 c8 00 00 00       	call   390 <runcmd>
+     2c8:	83 c4 10             	add    $0x10,%esp
+     2cb:	31 c0                	xor    %eax,%eax
+}
+     2cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2d0:	5b                   	pop    %ebx
+     2d1:	5e                   	pop    %esi
+     2d2:	5f                   	pop    %edi
+     2d3:	5d                   	pop    %ebp
+     2d4:	c3                   	ret
+     2d5:	8d 76 00             	lea    0x0(%esi),%esi
+      else if(acts[i].type == SPAWN_OPEN && open(acts[i].path, acts[i].arg) < 0){
+     2d8:	83 ec 08             	sub    $0x8,%esp
+     2db:	ff 76 08             	push   0x8(%esi)
+     2de:	ff 76 0c             	push   0xc(%esi)
+     2e1:	e8 fd 0d 00 00       	call   10e3 <open>
+     2e6:	83 c4 10             	add    $0x10,%esp
+     2e9:	85 c0                	test   %eax,%eax
+     2eb:	79 98                	jns    285 <startcmd+0xf5>
+        printf(2, "open %s failed\n", acts[i].path);
+     2ed:	c1 e3 04             	shl    $0x4,%ebx
+     2f0:	50                   	push   %eax
+     2f1:	ff b4 1d 74 ff ff ff 	push   -0x8c(%ebp,%ebx,1)
+     2f8:	68 50 15 00 00       	push   $0x1550
+     2fd:	6a 02                	push   $0x2
+     2ff:	e8 0c 0f 00 00       	call   1210 <printf>
+        exit();
+     304:	e8 9a 0d 00 00       	call   10a3 <exit>
+     309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((pid = spawn(ecmd->argv[0], ecmd->argv, acts, nact)) < 0)
+     310:	8d 95 68 ff ff ff    	lea    -0x98(%ebp),%edx
+     316:	57                   	push   %edi
+     317:	52                   	push   %edx
+     318:	8d 56 04             	lea    0x4(%esi),%edx
+     31b:	52                   	push   %edx
+     31c:	50                   	push   %eax
+     31d:	e8 41 0e 00 00       	call   1163 <spawn>
+     322:	83 c4 10             	add    $0x10,%esp
+     325:	85 c0                	test   %eax,%eax
+     327:	79 a4                	jns    2cd <startcmd+0x13d>
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+     329:	83 ec 04             	sub    $0x4,%esp
+     32c:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+     332:	ff 76 04             	push   0x4(%esi)
+     335:	68 3b 15 00 00       	push   $0x153b
+     33a:	6a 02                	push   $0x2
+     33c:	e8 cf 0e 00 00       	call   1210 <printf>
+     341:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+     347:	83 c4 10             	add    $0x10,%esp
+     34a:	eb 81                	jmp    2cd <startcmd+0x13d>
+     34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while(cmd->type == REDIR && nact < SPAWN_MAXACT){
+     350:	83 f9 02             	cmp    $0x2,%ecx
+     353:	0f 85 ec fe ff ff    	jne    245 <startcmd+0xb5>
+     359:	8d 9d 68 ff ff ff    	lea    -0x98(%ebp),%ebx
+     35f:	e9 a8 fe ff ff       	jmp    20c <startcmd+0x7c>
+  pid = fork();
+     364:	e8 32 0d 00 00       	call   109b <fork>
+  if(pid == -1)
+     369:	83 f8 ff             	cmp    $0xffffffff,%eax
+     36c:	74 0d                	je     37b <startcmd+0x1eb>
+  if((pid = fork1()) == 0){
+     36e:	85 c0                	test   %eax,%eax
+     370:	0f 84 fb fe ff ff    	je     271 <startcmd+0xe1>
+     376:	e9 52 ff ff ff       	jmp    2cd <startcmd+0x13d>
+    panic("fork");
+     37b:	83 ec 0c             	sub    $0xc,%esp
+     37e:	68 4b 15 00 00       	push   $0x154b
+     383:	e8 e8 fd ff ff       	call   170 <panic>
+     388:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38f:	90                   	nop
+
+00000390 <runcmd>:
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	57                   	push   %edi
+     394:	56                   	push   %esi
+     395:	53                   	push   %ebx
+     396:	83 ec 4c             	sub    $0x4c,%esp
+     399:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     39c:	85 db                	test   %ebx,%ebx
+     39e:	74 22                	je     3c2 <runcmd+0x32>
+  switch(cmd->type){
+     3a0:	83 3b 05             	cmpl   $0x5,(%ebx)
+     3a3:	0f 87 49 01 00 00    	ja     4f2 <runcmd+0x162>
+     3a9:	8b 03                	mov    (%ebx),%eax
+     3ab:	ff 24 85 f0 15 00 00 	jmp    *0x15f0(,%eax,4)
+    startcmd(bcmd->cmd, 0, 0);
+     3b2:	50                   	push   %eax
+     3b3:	6a 00                	push   $0x0
+     3b5:	6a 00                	push   $0x0
+     3b7:	ff 73 04             	push   0x4(%ebx)
+     3ba:	e8 d1 fd ff ff       	call   190 <startcmd>
+    break;
+     3bf:	83 c4 10             	add    $0x10,%esp
+    exit();
+     3c2:	e8 dc 0c 00 00       	call   10a3 <exit>
+    if(ecmd->argv[0] == 0)
+     3c7:	8b 43 04             	mov    0x4(%ebx),%eax
+     3ca:	85 c0                	test   %eax,%eax
+     3cc:	74 f4                	je     3c2 <runcmd+0x32>
+    exec(ecmd->argv[0], ecmd->argv);
+     3ce:	8d 53 04             	lea    0x4(%ebx),%edx
+     3d1:	51                   	push   %ecx
+     3d2:	51                   	push   %ecx
+     3d3:	52                   	push   %edx
+     3d4:	50                   	push   %eax
+     3d5:	e8 01 0d 00 00       	call   10db <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     3da:	83 c4 0c             	add    $0xc,%esp
+     3dd:	ff 73 04             	push   0x4(%ebx)
+     3e0:	68 3b 15 00 00       	push   $0x153b
+     3e5:	6a 02                	push   $0x2
+     3e7:	e8 24 0e 00 00       	call   1210 <printf>
+    break;
+     3ec:	83 c4 10             	add    $0x10,%esp
+     3ef:	eb d1                	jmp    3c2 <runcmd+0x32>
+    close(rcmd->fd);
+     3f1:	83 ec 0c             	sub    $0xc,%esp
+     3f4:	ff 73 14             	push   0x14(%ebx)
+     3f7:	e8 cf 0c 00 00       	call   10cb <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     3fc:	58                   	pop    %eax
+     3fd:	5a                   	pop    %edx
+     3fe:	ff 73 10             	push   0x10(%ebx)
+     401:	ff 73 08             	push   0x8(%ebx)
+     404:	e8 da 0c 00 00       	call   10e3 <open>
+     409:	83 c4 10             	add    $0x10,%esp
+     40c:	85 c0                	test   %eax,%eax
+     40e:	0f 88 eb 00 00 00    	js     4ff <runcmd+0x16f>
+    runcmd(rcmd->cmd);
+     414:	83 ec 0c             	sub    $0xc,%esp
+     417:	ff 73 04             	push   0x4(%ebx)
+     41a:	e8 71 ff ff ff       	call   390 <runcmd>
+    if(pipe(p) < 0)
+     41f:	83 ec 0c             	sub    $0xc,%esp
+     422:	8d 45 b0             	lea    -0x50(%ebp),%eax
+     425:	50                   	push   %eax
+     426:	e8 88 0c 00 00       	call   10b3 <pipe>
+     42b:	83 c4 10             	add    $0x10,%esp
+     42e:	85 c0                	test   %eax,%eax
+     430:	0f 88 de 00 00 00    	js     514 <runcmd+0x184>
+    act[1].fd = p[0];
+     436:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    n = startcmd(pcmd->left, act, 3) >= 0;
+     439:	8d 7d b8             	lea    -0x48(%ebp),%edi
+    act[1].type = act[2].type = SPAWN_CLOSE;
+     43c:	c7 45 d8 03 00 00 00 	movl   $0x3,-0x28(%ebp)
+     443:	c7 45 c8 03 00 00 00 	movl   $0x3,-0x38(%ebp)
+    act[1].fd = p[0];
+     44a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    act[2].fd = p[1];
+     44d:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    act[0].type = SPAWN_DUP2;
+     450:	c7 45 b8 02 00 00 00 	movl   $0x2,-0x48(%ebp)
+    act[2].fd = p[1];
+     457:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    act[0].fd = 1;
+     45a:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%ebp)
+    act[0].arg = p[1];
+     461:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    n = startcmd(pcmd->left, act, 3) >= 0;
+     464:	52                   	push   %edx
+     465:	6a 03                	push   $0x3
+     467:	57                   	push   %edi
+     468:	ff 73 04             	push   0x4(%ebx)
+     46b:	e8 20 fd ff ff       	call   190 <startcmd>
+    n += startcmd(pcmd->right, act, 3) >= 0;
+     470:	83 c4 0c             	add    $0xc,%esp
+    act[0].fd = 0;
+     473:	31 c9                	xor    %ecx,%ecx
+    n = startcmd(pcmd->left, act, 3) >= 0;
+     475:	f7 d0                	not    %eax
+    act[0].fd = 0;
+     477:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+    n = startcmd(pcmd->left, act, 3) >= 0;
+     47a:	89 c6                	mov    %eax,%esi
+    act[0].arg = p[0];
+     47c:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    n = startcmd(pcmd->left, act, 3) >= 0;
+     47f:	c1 ee 1f             	shr    $0x1f,%esi
+    act[0].arg = p[0];
+     482:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    n += startcmd(pcmd->right, act, 3) >= 0;
+     485:	6a 03                	push   $0x3
+     487:	57                   	push   %edi
+     488:	ff 73 08             	push   0x8(%ebx)
+     48b:	e8 00 fd ff ff       	call   190 <startcmd>
+     490:	f7 d0                	not    %eax
+     492:	89 c3                	mov    %eax,%ebx
+     494:	c1 eb 1f             	shr    $0x1f,%ebx
+     497:	01 f3                	add    %esi,%ebx
+    close(p[0]);
+     499:	5e                   	pop    %esi
+     49a:	ff 75 b0             	push   -0x50(%ebp)
+     49d:	e8 29 0c 00 00       	call   10cb <close>
+    close(p[1]);
+     4a2:	5f                   	pop    %edi
+     4a3:	ff 75 b4             	push   -0x4c(%ebp)
+     4a6:	e8 20 0c 00 00       	call   10cb <close>
+    while(n-- > 0)
+     4ab:	83 c4 10             	add    $0x10,%esp
+     4ae:	85 db                	test   %ebx,%ebx
+     4b0:	0f 84 0c ff ff ff    	je     3c2 <runcmd+0x32>
+      wait();
+     4b6:	e8 f0 0b 00 00       	call   10ab <wait>
+    while(n-- > 0)
+     4bb:	83 eb 01             	sub    $0x1,%ebx
+     4be:	0f 84 fe fe ff ff    	je     3c2 <runcmd+0x32>
+      wait();
+     4c4:	e8 e2 0b 00 00       	call   10ab <wait>
+    while(n-- > 0)
+     4c9:	e9 f4 fe ff ff       	jmp    3c2 <runcmd+0x32>
+    if(startcmd(lcmd->left, 0, 0) >= 0)
+     4ce:	50                   	push   %eax
+     4cf:	6a 00                	push   $0x0
+     4d1:	6a 00                	push   $0x0
+     4d3:	ff 73 04             	push   0x4(%ebx)
+     4d6:	e8 b5 fc ff ff       	call   190 <startcmd>
+     4db:	83 c4 10             	add    $0x10,%esp
+     4de:	85 c0                	test   %eax,%eax
+     4e0:	78 05                	js     4e7 <runcmd+0x157>
+      wait();
+     4e2:	e8 c4 0b 00 00       	call   10ab <wait>
+    runcmd(lcmd->right);
+     4e7:	83 ec 0c             	sub    $0xc,%esp
+     4ea:	ff 73 08             	push   0x8(%ebx)
+     4ed:	e8 9e fe ff ff       	call   390 <runcmd>
+    panic("runcmd");
+     4f2:	83 ec 0c             	sub    $0xc,%esp
+     4f5:	68 60 15 00 00       	push   $0x1560
+     4fa:	e8 71 fc ff ff       	call   170 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     4ff:	50                   	push   %eax
+     500:	ff 73 08             	push   0x8(%ebx)
+     503:	68 50 15 00 00       	push   $0x1550
+     508:	6a 02                	push   $0x2
+     50a:	e8 01 0d 00 00       	call   1210 <printf>
+      exit();
+     50f:	e8 8f 0b 00 00       	call   10a3 <exit>
+      panic("pipe");
+     514:	83 ec 0c             	sub    $0xc,%esp
+     517:	68 67 15 00 00       	push   $0x1567
+     51c:	e8 4f fc ff ff       	call   170 <panic>
+     521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52f:	90                   	nop
+
+00000530 <fork1>:
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     536:	e8 60 0b 00 00       	call   109b <fork>
+  if(pid == -1)
+     53b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     53e:	74 02                	je     542 <fork1+0x12>
+  return pid;
+}
+     540:	c9                   	leave
+     541:	c3                   	ret
+    panic("fork");
+     542:	83 ec 0c             	sub    $0xc,%esp
+     545:	68 4b 15 00 00       	push   $0x154b
+     54a:	e8 21 fc ff ff       	call   170 <panic>
+     54f:	90                   	nop
+
+00000550 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	53                   	push   %ebx
+     554:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     557:	6a 54                	push   $0x54
+     559:	e8 f2 0e 00 00       	call   1450 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     55e:	83 c4 0c             	add    $0xc,%esp
+     561:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     563:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     565:	6a 00                	push   $0x0
+     567:	50                   	push   %eax
+     568:	e8 b3 09 00 00       	call   f20 <memset>
+  cmd->type = EXEC;
+     56d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     573:	89 d8                	mov    %ebx,%eax
+     575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     578:	c9                   	leave
+     579:	c3                   	ret
+     57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000580 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	53                   	push   %ebx
+     584:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     587:	6a 18                	push   $0x18
+     589:	e8 c2 0e 00 00       	call   1450 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     58e:	83 c4 0c             	add    $0xc,%esp
+     591:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     593:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     595:	6a 00                	push   $0x0
+     597:	50                   	push   %eax
+     598:	e8 83 09 00 00       	call   f20 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     59d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     5a0:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     5a6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     5a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5ac:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     5af:	8b 45 10             	mov    0x10(%ebp),%eax
+     5b2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     5b5:	8b 45 14             	mov    0x14(%ebp),%eax
+     5b8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     5bb:	8b 45 18             	mov    0x18(%ebp),%eax
+     5be:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     5c1:	89 d8                	mov    %ebx,%eax
+     5c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5c6:	c9                   	leave
+     5c7:	c3                   	ret
+     5c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cf:	90                   	nop
+
+000005d0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	53                   	push   %ebx
+     5d4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     5d7:	6a 0c                	push   $0xc
+     5d9:	e8 72 0e 00 00       	call   1450 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     5de:	83 c4 0c             	add    $0xc,%esp
+     5e1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     5e3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     5e5:	6a 00                	push   $0x0
+     5e7:	50                   	push   %eax
+     5e8:	e8 33 09 00 00       	call   f20 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     5ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     5f0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     5f6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     5f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5fc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     5ff:	89 d8                	mov    %ebx,%eax
+     601:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     604:	c9                   	leave
+     605:	c3                   	ret
+     606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000610 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	53                   	push   %ebx
+     614:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     617:	6a 0c                	push   $0xc
+     619:	e8 32 0e 00 00       	call   1450 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     61e:	83 c4 0c             	add    $0xc,%esp
+     621:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     623:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     625:	6a 00                	push   $0x0
+     627:	50                   	push   %eax
+     628:	e8 f3 08 00 00       	call   f20 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     62d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     630:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     636:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     639:	8b 45 0c             	mov    0xc(%ebp),%eax
+     63c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     63f:	89 d8                	mov    %ebx,%eax
+     641:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     644:	c9                   	leave
+     645:	c3                   	ret
+     646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000650 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	53                   	push   %ebx
+     654:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     657:	6a 08                	push   $0x8
+     659:	e8 f2 0d 00 00       	call   1450 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     65e:	83 c4 0c             	add    $0xc,%esp
+     661:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     663:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     665:	6a 00                	push   $0x0
+     667:	50                   	push   %eax
+     668:	e8 b3 08 00 00       	call   f20 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     66d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     670:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     676:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     679:	89 d8                	mov    %ebx,%eax
+     67b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     67e:	c9                   	leave
+     67f:	c3                   	ret
+
+00000680 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	57                   	push   %edi
+     684:	56                   	push   %esi
+     685:	53                   	push   %ebx
+     686:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     689:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     68c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     68f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     692:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     694:	39 df                	cmp    %ebx,%edi
+     696:	72 0f                	jb     6a7 <gettoken+0x27>
+     698:	eb 25                	jmp    6bf <gettoken+0x3f>
+     69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     6a0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     6a3:	39 fb                	cmp    %edi,%ebx
+     6a5:	74 18                	je     6bf <gettoken+0x3f>
+     6a7:	0f be 07             	movsbl (%edi),%eax
+     6aa:	83 ec 08             	sub    $0x8,%esp
+     6ad:	50                   	push   %eax
+     6ae:	68 a4 1c 00 00       	push   $0x1ca4
+     6b3:	e8 88 08 00 00       	call   f40 <strchr>
+     6b8:	83 c4 10             	add    $0x10,%esp
+     6bb:	85 c0                	test   %eax,%eax
+     6bd:	75 e1                	jne    6a0 <gettoken+0x20>
+  if(q)
+     6bf:	85 f6                	test   %esi,%esi
+     6c1:	74 02                	je     6c5 <gettoken+0x45>
+    *q = s;
+     6c3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     6c5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     6c8:	3c 3c                	cmp    $0x3c,%al
+     6ca:	0f 8f d0 00 00 00    	jg     7a0 <gettoken+0x120>
+     6d0:	3c 3a                	cmp    $0x3a,%al
+     6d2:	0f 8f bc 00 00 00    	jg     794 <gettoken+0x114>
+     6d8:	84 c0                	test   %al,%al
+     6da:	75 44                	jne    720 <gettoken+0xa0>
+     6dc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     6de:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     6e1:	85 c9                	test   %ecx,%ecx
+     6e3:	74 05                	je     6ea <gettoken+0x6a>
+    *eq = s;
+     6e5:	8b 45 14             	mov    0x14(%ebp),%eax
+     6e8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     6ea:	39 df                	cmp    %ebx,%edi
+     6ec:	72 09                	jb     6f7 <gettoken+0x77>
+     6ee:	eb 1f                	jmp    70f <gettoken+0x8f>
+    s++;
+     6f0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     6f3:	39 fb                	cmp    %edi,%ebx
+     6f5:	74 18                	je     70f <gettoken+0x8f>
+     6f7:	0f be 07             	movsbl (%edi),%eax
+     6fa:	83 ec 08             	sub    $0x8,%esp
+     6fd:	50                   	push   %eax
+     6fe:	68 a4 1c 00 00       	push   $0x1ca4
+     703:	e8 38 08 00 00       	call   f40 <strchr>
+     708:	83 c4 10             	add    $0x10,%esp
+     70b:	85 c0                	test   %eax,%eax
+     70d:	75 e1                	jne    6f0 <gettoken+0x70>
+  *ps = s;
+     70f:	8b 45 08             	mov    0x8(%ebp),%eax
+     712:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     714:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     717:	89 f0                	mov    %esi,%eax
+     719:	5b                   	pop    %ebx
+     71a:	5e                   	pop    %esi
+     71b:	5f                   	pop    %edi
+     71c:	5d                   	pop    %ebp
+     71d:	c3                   	ret
+     71e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     720:	79 66                	jns    788 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     722:	39 df                	cmp    %ebx,%edi
+     724:	72 39                	jb     75f <gettoken+0xdf>
+  if(eq)
+     726:	8b 55 14             	mov    0x14(%ebp),%edx
+     729:	85 d2                	test   %edx,%edx
+     72b:	0f 84 b3 00 00 00    	je     7e4 <gettoken+0x164>
+    *eq = s;
+     731:	8b 45 14             	mov    0x14(%ebp),%eax
+     734:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     736:	e9 a9 00 00 00       	jmp    7e4 <gettoken+0x164>
+     73b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     73f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     740:	0f be 07             	movsbl (%edi),%eax
+     743:	83 ec 08             	sub    $0x8,%esp
+     746:	50                   	push   %eax
+     747:	68 9c 1c 00 00       	push   $0x1c9c
+     74c:	e8 ef 07 00 00       	call   f40 <strchr>
+     751:	83 c4 10             	add    $0x10,%esp
+     754:	85 c0                	test   %eax,%eax
+     756:	75 1f                	jne    777 <gettoken+0xf7>
+      s++;
+     758:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     75b:	39 fb                	cmp    %edi,%ebx
+     75d:	74 77                	je     7d6 <gettoken+0x156>
+     75f:	0f be 07             	movsbl (%edi),%eax
+     762:	83 ec 08             	sub    $0x8,%esp
+     765:	50                   	push   %eax
+     766:	68 a4 1c 00 00       	push   $0x1ca4
+     76b:	e8 d0 07 00 00       	call   f40 <strchr>
+     770:	83 c4 10             	add    $0x10,%esp
+     773:	85 c0                	test   %eax,%eax
+     775:	74 c9                	je     740 <gettoken+0xc0>
+    ret = 'a';
+     777:	be 61 00 00 00       	mov    $0x61,%esi
+     77c:	e9 5d ff ff ff       	jmp    6de <gettoken+0x5e>
+     781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     788:	3c 26                	cmp    $0x26,%al
+     78a:	74 08                	je     794 <gettoken+0x114>
+     78c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     78f:	80 f9 01             	cmp    $0x1,%cl
+     792:	77 8e                	ja     722 <gettoken+0xa2>
+  ret = *s;
+     794:	0f be f0             	movsbl %al,%esi
+    s++;
+     797:	83 c7 01             	add    $0x1,%edi
+    break;
+     79a:	e9 3f ff ff ff       	jmp    6de <gettoken+0x5e>
+     79f:	90                   	nop
+  switch(*s){
+     7a0:	3c 3e                	cmp    $0x3e,%al
+     7a2:	75 1c                	jne    7c0 <gettoken+0x140>
+    if(*s == '>'){
+     7a4:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     7a8:	74 1f                	je     7c9 <gettoken+0x149>
+    s++;
+     7aa:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     7ad:	be 3e 00 00 00       	mov    $0x3e,%esi
+     7b2:	e9 27 ff ff ff       	jmp    6de <gettoken+0x5e>
+     7b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7be:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     7c0:	3c 7c                	cmp    $0x7c,%al
+     7c2:	74 d0                	je     794 <gettoken+0x114>
+     7c4:	e9 59 ff ff ff       	jmp    722 <gettoken+0xa2>
+      s++;
+     7c9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     7cc:	be 2b 00 00 00       	mov    $0x2b,%esi
+     7d1:	e9 08 ff ff ff       	jmp    6de <gettoken+0x5e>
+  if(eq)
+     7d6:	8b 45 14             	mov    0x14(%ebp),%eax
+     7d9:	85 c0                	test   %eax,%eax
+     7db:	74 05                	je     7e2 <gettoken+0x162>
+    *eq = s;
+     7dd:	8b 45 14             	mov    0x14(%ebp),%eax
+     7e0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     7e2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     7e4:	be 61 00 00 00       	mov    $0x61,%esi
+     7e9:	e9 21 ff ff ff       	jmp    70f <gettoken+0x8f>
+     7ee:	66 90                	xchg   %ax,%ax
+
+000007f0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+     7f3:	57                   	push   %edi
+     7f4:	56                   	push   %esi
+     7f5:	53                   	push   %ebx
+     7f6:	83 ec 0c             	sub    $0xc,%esp
+     7f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     7fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     7ff:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     801:	39 f3                	cmp    %esi,%ebx
+     803:	72 12                	jb     817 <peek+0x27>
+     805:	eb 28                	jmp    82f <peek+0x3f>
+     807:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80e:	66 90                	xchg   %ax,%ax
+    s++;
+     810:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     813:	39 de                	cmp    %ebx,%esi
+     815:	74 18                	je     82f <peek+0x3f>
+     817:	0f be 03             	movsbl (%ebx),%eax
+     81a:	83 ec 08             	sub    $0x8,%esp
+     81d:	50                   	push   %eax
+     81e:	68 a4 1c 00 00       	push   $0x1ca4
+     823:	e8 18 07 00 00       	call   f40 <strchr>
+     828:	83 c4 10             	add    $0x10,%esp
+     82b:	85 c0                	test   %eax,%eax
+     82d:	75 e1                	jne    810 <peek+0x20>
+  *ps = s;
+     82f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     831:	0f be 03             	movsbl (%ebx),%eax
+     834:	31 d2                	xor    %edx,%edx
+     836:	84 c0                	test   %al,%al
+     838:	75 0e                	jne    848 <peek+0x58>
+}
+     83a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     83d:	89 d0                	mov    %edx,%eax
+     83f:	5b                   	pop    %ebx
+     840:	5e                   	pop    %esi
+     841:	5f                   	pop    %edi
+     842:	5d                   	pop    %ebp
+     843:	c3                   	ret
+     844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     848:	83 ec 08             	sub    $0x8,%esp
+     84b:	50                   	push   %eax
+     84c:	ff 75 10             	push   0x10(%ebp)
+     84f:	e8 ec 06 00 00       	call   f40 <strchr>
+     854:	83 c4 10             	add    $0x10,%esp
+     857:	31 d2                	xor    %edx,%edx
+     859:	85 c0                	test   %eax,%eax
+     85b:	0f 95 c2             	setne  %dl
+}
+     85e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     861:	5b                   	pop    %ebx
+     862:	89 d0                	mov    %edx,%eax
+     864:	5e                   	pop    %esi
+     865:	5f                   	pop    %edi
+     866:	5d                   	pop    %ebp
+     867:	c3                   	ret
+     868:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86f:	90                   	nop
+
+00000870 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	57                   	push   %edi
+     874:	56                   	push   %esi
+     875:	53                   	push   %ebx
+     876:	83 ec 2c             	sub    $0x2c,%esp
+     879:	8b 75 0c             	mov    0xc(%ebp),%esi
+     87c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     87f:	90                   	nop
+     880:	83 ec 04             	sub    $0x4,%esp
+     883:	68 89 15 00 00       	push   $0x1589
+     888:	53                   	push   %ebx
+     889:	56                   	push   %esi
+     88a:	e8 61 ff ff ff       	call   7f0 <peek>
+     88f:	83 c4 10             	add    $0x10,%esp
+     892:	85 c0                	test   %eax,%eax
+     894:	0f 84 f6 00 00 00    	je     990 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     89a:	6a 00                	push   $0x0
+     89c:	6a 00                	push   $0x0
+     89e:	53                   	push   %ebx
+     89f:	56                   	push   %esi
+     8a0:	e8 db fd ff ff       	call   680 <gettoken>
+     8a5:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     8a7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     8aa:	50                   	push   %eax
+     8ab:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     8ae:	50                   	push   %eax
+     8af:	53                   	push   %ebx
+     8b0:	56                   	push   %esi
+     8b1:	e8 ca fd ff ff       	call   680 <gettoken>
+     8b6:	83 c4 20             	add    $0x20,%esp
+     8b9:	83 f8 61             	cmp    $0x61,%eax
+     8bc:	0f 85 d9 00 00 00    	jne    99b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     8c2:	83 ff 3c             	cmp    $0x3c,%edi
+     8c5:	74 69                	je     930 <parseredirs+0xc0>
+     8c7:	83 ff 3e             	cmp    $0x3e,%edi
+     8ca:	74 05                	je     8d1 <parseredirs+0x61>
+     8cc:	83 ff 2b             	cmp    $0x2b,%edi
+     8cf:	75 af                	jne    880 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     8d1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     8d4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     8d7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     8da:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     8dd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     8e0:	6a 18                	push   $0x18
+     8e2:	e8 69 0b 00 00       	call   1450 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     8e7:	83 c4 0c             	add    $0xc,%esp
+     8ea:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     8ec:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     8ee:	6a 00                	push   $0x0
+     8f0:	50                   	push   %eax
+     8f1:	e8 2a 06 00 00       	call   f20 <memset>
+  cmd->type = REDIR;
+     8f6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     8fc:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     8ff:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     902:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     905:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     908:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     90b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     90e:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     915:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     918:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     91f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     922:	e9 59 ff ff ff       	jmp    880 <parseredirs+0x10>
+     927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     930:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     933:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     936:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     939:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     93c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     93f:	6a 18                	push   $0x18
+     941:	e8 0a 0b 00 00       	call   1450 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     946:	83 c4 0c             	add    $0xc,%esp
+     949:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     94b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     94d:	6a 00                	push   $0x0
+     94f:	50                   	push   %eax
+     950:	e8 cb 05 00 00       	call   f20 <memset>
+  cmd->cmd = subcmd;
+     955:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     958:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     95b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     95e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     961:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     967:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     96a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     96d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     970:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     973:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     97a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     981:	e9 fa fe ff ff       	jmp    880 <parseredirs+0x10>
+     986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     990:	8b 45 08             	mov    0x8(%ebp),%eax
+     993:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     996:	5b                   	pop    %ebx
+     997:	5e                   	pop    %esi
+     998:	5f                   	pop    %edi
+     999:	5d                   	pop    %ebp
+     99a:	c3                   	ret
+      panic("missing file for redirection");
+     99b:	83 ec 0c             	sub    $0xc,%esp
+     99e:	68 6c 15 00 00       	push   $0x156c
+     9a3:	e8 c8 f7 ff ff       	call   170 <panic>
+     9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9af:	90                   	nop
+
+000009b0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	57                   	push   %edi
+     9b4:	56                   	push   %esi
+     9b5:	53                   	push   %ebx
+     9b6:	83 ec 30             	sub    $0x30,%esp
+     9b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     9bc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     9bf:	68 8c 15 00 00       	push   $0x158c
+     9c4:	56                   	push   %esi
+     9c5:	53                   	push   %ebx
+     9c6:	e8 25 fe ff ff       	call   7f0 <peek>
+     9cb:	83 c4 10             	add    $0x10,%esp
+     9ce:	85 c0                	test   %eax,%eax
+     9d0:	0f 85 aa 00 00 00    	jne    a80 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     9d6:	83 ec 0c             	sub    $0xc,%esp
+     9d9:	89 c7                	mov    %eax,%edi
+     9db:	6a 54                	push   $0x54
+     9dd:	e8 6e 0a 00 00       	call   1450 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     9e2:	83 c4 0c             	add    $0xc,%esp
+     9e5:	6a 54                	push   $0x54
+     9e7:	6a 00                	push   $0x0
+     9e9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     9ec:	50                   	push   %eax
+     9ed:	e8 2e 05 00 00       	call   f20 <memset>
+  cmd->type = EXEC;
+     9f2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     9f5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     9f8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     9fe:	56                   	push   %esi
+     9ff:	53                   	push   %ebx
+     a00:	50                   	push   %eax
+     a01:	e8 6a fe ff ff       	call   870 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     a06:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     a09:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     a0c:	eb 15                	jmp    a23 <parseexec+0x73>
+     a0e:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     a10:	83 ec 04             	sub    $0x4,%esp
+     a13:	56                   	push   %esi
+     a14:	53                   	push   %ebx
+     a15:	ff 75 d4             	push   -0x2c(%ebp)
+     a18:	e8 53 fe ff ff       	call   870 <parseredirs>
+     a1d:	83 c4 10             	add    $0x10,%esp
+     a20:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     a23:	83 ec 04             	sub    $0x4,%esp
+     a26:	68 a3 15 00 00       	push   $0x15a3
+     a2b:	56                   	push   %esi
+     a2c:	53                   	push   %ebx
+     a2d:	e8 be fd ff ff       	call   7f0 <peek>
+     a32:	83 c4 10             	add    $0x10,%esp
+     a35:	85 c0                	test   %eax,%eax
+     a37:	75 5f                	jne    a98 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     a39:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     a3c:	50                   	push   %eax
+     a3d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     a40:	50                   	push   %eax
+     a41:	56                   	push   %esi
+     a42:	53                   	push   %ebx
+     a43:	e8 38 fc ff ff       	call   680 <gettoken>
+     a48:	83 c4 10             	add    $0x10,%esp
+     a4b:	85 c0                	test   %eax,%eax
+     a4d:	74 49                	je     a98 <parseexec+0xe8>
+    if(tok != 'a')
+     a4f:	83 f8 61             	cmp    $0x61,%eax
+     a52:	75 62                	jne    ab6 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     a54:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     a57:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     a5a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     a5e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a61:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     a65:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     a68:	83 ff 0a             	cmp    $0xa,%edi
+     a6b:	75 a3                	jne    a10 <parseexec+0x60>
+      panic("too many args");
+     a6d:	83 ec 0c             	sub    $0xc,%esp
+     a70:	68 95 15 00 00       	push   $0x1595
+     a75:	e8 f6 f6 ff ff       	call   170 <panic>
+     a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     a80:	89 75 0c             	mov    %esi,0xc(%ebp)
+     a83:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     a86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a89:	5b                   	pop    %ebx
+     a8a:	5e                   	pop    %esi
+     a8b:	5f                   	pop    %edi
+     a8c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     a8d:	e9 ae 01 00 00       	jmp    c40 <parseblock>
+     a92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     a98:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     a9b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     aa2:	00 
+  cmd->eargv[argc] = 0;
+     aa3:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     aaa:	00 
+}
+     aab:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     aae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ab1:	5b                   	pop    %ebx
+     ab2:	5e                   	pop    %esi
+     ab3:	5f                   	pop    %edi
+     ab4:	5d                   	pop    %ebp
+     ab5:	c3                   	ret
+      panic("syntax");
+     ab6:	83 ec 0c             	sub    $0xc,%esp
+     ab9:	68 8e 15 00 00       	push   $0x158e
+     abe:	e8 ad f6 ff ff       	call   170 <panic>
+     ac3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ad0 <parsepipe>:
+{
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	57                   	push   %edi
+     ad4:	56                   	push   %esi
+     ad5:	53                   	push   %ebx
+     ad6:	83 ec 14             	sub    $0x14,%esp
+     ad9:	8b 75 08             	mov    0x8(%ebp),%esi
+     adc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     adf:	57                   	push   %edi
+     ae0:	56                   	push   %esi
+     ae1:	e8 ca fe ff ff       	call   9b0 <parseexec>
+  if(peek(ps, es, "|")){
+     ae6:	83 c4 0c             	add    $0xc,%esp
+     ae9:	68 a8 15 00 00       	push   $0x15a8
+  cmd = parseexec(ps, es);
+     aee:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     af0:	57                   	push   %edi
+     af1:	56                   	push   %esi
+     af2:	e8 f9 fc ff ff       	call   7f0 <peek>
+     af7:	83 c4 10             	add    $0x10,%esp
+     afa:	85 c0                	test   %eax,%eax
+     afc:	75 12                	jne    b10 <parsepipe+0x40>
+}
+     afe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b01:	89 d8                	mov    %ebx,%eax
+     b03:	5b                   	pop    %ebx
+     b04:	5e                   	pop    %esi
+     b05:	5f                   	pop    %edi
+     b06:	5d                   	pop    %ebp
+     b07:	c3                   	ret
+     b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     b10:	6a 00                	push   $0x0
+     b12:	6a 00                	push   $0x0
+     b14:	57                   	push   %edi
+     b15:	56                   	push   %esi
+     b16:	e8 65 fb ff ff       	call   680 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     b1b:	58                   	pop    %eax
+     b1c:	5a                   	pop    %edx
+     b1d:	57                   	push   %edi
+     b1e:	56                   	push   %esi
+     b1f:	e8 ac ff ff ff       	call   ad0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     b24:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     b2b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     b2d:	e8 1e 09 00 00       	call   1450 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b32:	83 c4 0c             	add    $0xc,%esp
+     b35:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     b37:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     b39:	6a 00                	push   $0x0
+     b3b:	50                   	push   %eax
+     b3c:	e8 df 03 00 00       	call   f20 <memset>
+  cmd->left = left;
+     b41:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     b44:	83 c4 10             	add    $0x10,%esp
+     b47:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     b49:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     b4f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     b51:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     b54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b57:	5b                   	pop    %ebx
+     b58:	5e                   	pop    %esi
+     b59:	5f                   	pop    %edi
+     b5a:	5d                   	pop    %ebp
+     b5b:	c3                   	ret
+     b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b60 <parseline>:
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+     b65:	53                   	push   %ebx
+     b66:	83 ec 24             	sub    $0x24,%esp
+     b69:	8b 75 08             	mov    0x8(%ebp),%esi
+     b6c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     b6f:	57                   	push   %edi
+     b70:	56                   	push   %esi
+     b71:	e8 5a ff ff ff       	call   ad0 <parsepipe>
+  while(peek(ps, es, "&")){
+     b76:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     b79:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     b7b:	eb 3b                	jmp    bb8 <parseline+0x58>
+     b7d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     b80:	6a 00                	push   $0x0
+     b82:	6a 00                	push   $0x0
+     b84:	57                   	push   %edi
+     b85:	56                   	push   %esi
+     b86:	e8 f5 fa ff ff       	call   680 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     b8b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     b92:	e8 b9 08 00 00       	call   1450 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b97:	83 c4 0c             	add    $0xc,%esp
+     b9a:	6a 08                	push   $0x8
+     b9c:	6a 00                	push   $0x0
+     b9e:	50                   	push   %eax
+     b9f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     ba2:	e8 79 03 00 00       	call   f20 <memset>
+  cmd->type = BACK;
+     ba7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     baa:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     bad:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     bb3:	89 5a 04             	mov    %ebx,0x4(%edx)
+     bb6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     bb8:	83 ec 04             	sub    $0x4,%esp
+     bbb:	68 aa 15 00 00       	push   $0x15aa
+     bc0:	57                   	push   %edi
+     bc1:	56                   	push   %esi
+     bc2:	e8 29 fc ff ff       	call   7f0 <peek>
+     bc7:	83 c4 10             	add    $0x10,%esp
+     bca:	85 c0                	test   %eax,%eax
+     bcc:	75 b2                	jne    b80 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     bce:	83 ec 04             	sub    $0x4,%esp
+     bd1:	68 a6 15 00 00       	push   $0x15a6
+     bd6:	57                   	push   %edi
+     bd7:	56                   	push   %esi
+     bd8:	e8 13 fc ff ff       	call   7f0 <peek>
+     bdd:	83 c4 10             	add    $0x10,%esp
+     be0:	85 c0                	test   %eax,%eax
+     be2:	75 0c                	jne    bf0 <parseline+0x90>
+}
+     be4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     be7:	89 d8                	mov    %ebx,%eax
+     be9:	5b                   	pop    %ebx
+     bea:	5e                   	pop    %esi
+     beb:	5f                   	pop    %edi
+     bec:	5d                   	pop    %ebp
+     bed:	c3                   	ret
+     bee:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     bf0:	6a 00                	push   $0x0
+     bf2:	6a 00                	push   $0x0
+     bf4:	57                   	push   %edi
+     bf5:	56                   	push   %esi
+     bf6:	e8 85 fa ff ff       	call   680 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     bfb:	58                   	pop    %eax
+     bfc:	5a                   	pop    %edx
+     bfd:	57                   	push   %edi
+     bfe:	56                   	push   %esi
+     bff:	e8 5c ff ff ff       	call   b60 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     c04:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     c0b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     c0d:	e8 3e 08 00 00       	call   1450 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     c12:	83 c4 0c             	add    $0xc,%esp
+     c15:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     c17:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     c19:	6a 00                	push   $0x0
+     c1b:	50                   	push   %eax
+     c1c:	e8 ff 02 00 00       	call   f20 <memset>
+  cmd->left = left;
+     c21:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     c24:	83 c4 10             	add    $0x10,%esp
+     c27:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     c29:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     c2f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     c31:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c37:	5b                   	pop    %ebx
+     c38:	5e                   	pop    %esi
+     c39:	5f                   	pop    %edi
+     c3a:	5d                   	pop    %ebp
+     c3b:	c3                   	ret
+     c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c40 <parseblock>:
+{
+     c40:	55                   	push   %ebp
+     c41:	89 e5                	mov    %esp,%ebp
+     c43:	57                   	push   %edi
+     c44:	56                   	push   %esi
+     c45:	53                   	push   %ebx
+     c46:	83 ec 10             	sub    $0x10,%esp
+     c49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     c4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     c4f:	68 8c 15 00 00       	push   $0x158c
+     c54:	56                   	push   %esi
+     c55:	53                   	push   %ebx
+     c56:	e8 95 fb ff ff       	call   7f0 <peek>
+     c5b:	83 c4 10             	add    $0x10,%esp
+     c5e:	85 c0                	test   %eax,%eax
+     c60:	74 4a                	je     cac <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     c62:	6a 00                	push   $0x0
+     c64:	6a 00                	push   $0x0
+     c66:	56                   	push   %esi
+     c67:	53                   	push   %ebx
+     c68:	e8 13 fa ff ff       	call   680 <gettoken>
+  cmd = parseline(ps, es);
+     c6d:	58                   	pop    %eax
+     c6e:	5a                   	pop    %edx
+     c6f:	56                   	push   %esi
+     c70:	53                   	push   %ebx
+     c71:	e8 ea fe ff ff       	call   b60 <parseline>
+  if(!peek(ps, es, ")"))
+     c76:	83 c4 0c             	add    $0xc,%esp
+     c79:	68 c8 15 00 00       	push   $0x15c8
+  cmd = parseline(ps, es);
+     c7e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     c80:	56                   	push   %esi
+     c81:	53                   	push   %ebx
+     c82:	e8 69 fb ff ff       	call   7f0 <peek>
+     c87:	83 c4 10             	add    $0x10,%esp
+     c8a:	85 c0                	test   %eax,%eax
+     c8c:	74 2b                	je     cb9 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     c8e:	6a 00                	push   $0x0
+     c90:	6a 00                	push   $0x0
+     c92:	56                   	push   %esi
+     c93:	53                   	push   %ebx
+     c94:	e8 e7 f9 ff ff       	call   680 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     c99:	83 c4 0c             	add    $0xc,%esp
+     c9c:	56                   	push   %esi
+     c9d:	53                   	push   %ebx
+     c9e:	57                   	push   %edi
+     c9f:	e8 cc fb ff ff       	call   870 <parseredirs>
+}
+     ca4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ca7:	5b                   	pop    %ebx
+     ca8:	5e                   	pop    %esi
+     ca9:	5f                   	pop    %edi
+     caa:	5d                   	pop    %ebp
+     cab:	c3                   	ret
+    panic("parseblock");
+     cac:	83 ec 0c             	sub    $0xc,%esp
+     caf:	68 ac 15 00 00       	push   $0x15ac
+     cb4:	e8 b7 f4 ff ff       	call   170 <panic>
+    panic("syntax - missing )");
+     cb9:	83 ec 0c             	sub    $0xc,%esp
+     cbc:	68 b7 15 00 00       	push   $0x15b7
+     cc1:	e8 aa f4 ff ff       	call   170 <panic>
+     cc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ccd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cd0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	53                   	push   %ebx
+     cd4:	83 ec 04             	sub    $0x4,%esp
+     cd7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     cda:	85 db                	test   %ebx,%ebx
+     cdc:	0f 84 7e 00 00 00    	je     d60 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     ce2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     ce5:	77 20                	ja     d07 <nulterminate+0x37>
+     ce7:	8b 03                	mov    (%ebx),%eax
+     ce9:	ff 24 85 08 16 00 00 	jmp    *0x1608(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     cf0:	83 ec 0c             	sub    $0xc,%esp
+     cf3:	ff 73 04             	push   0x4(%ebx)
+     cf6:	e8 d5 ff ff ff       	call   cd0 <nulterminate>
+    nulterminate(lcmd->right);
+     cfb:	58                   	pop    %eax
+     cfc:	ff 73 08             	push   0x8(%ebx)
+     cff:	e8 cc ff ff ff       	call   cd0 <nulterminate>
+    break;
+     d04:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     d07:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     d09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d0c:	c9                   	leave
+     d0d:	c3                   	ret
+     d0e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     d10:	83 ec 0c             	sub    $0xc,%esp
+     d13:	ff 73 04             	push   0x4(%ebx)
+     d16:	e8 b5 ff ff ff       	call   cd0 <nulterminate>
+    break;
+     d1b:	83 c4 10             	add    $0x10,%esp
+     d1e:	eb e7                	jmp    d07 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     d20:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     d23:	8d 43 08             	lea    0x8(%ebx),%eax
+     d26:	85 c9                	test   %ecx,%ecx
+     d28:	74 dd                	je     d07 <nulterminate+0x37>
+     d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     d30:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     d33:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     d36:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     d39:	8b 50 fc             	mov    -0x4(%eax),%edx
+     d3c:	85 d2                	test   %edx,%edx
+     d3e:	75 f0                	jne    d30 <nulterminate+0x60>
+     d40:	eb c5                	jmp    d07 <nulterminate+0x37>
+     d42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     d48:	83 ec 0c             	sub    $0xc,%esp
+     d4b:	ff 73 04             	push   0x4(%ebx)
+     d4e:	e8 7d ff ff ff       	call   cd0 <nulterminate>
+    *rcmd->efile = 0;
+     d53:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     d56:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     d59:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     d5c:	eb a9                	jmp    d07 <nulterminate+0x37>
+     d5e:	66 90                	xchg   %ax,%ax
+    return 0;
+     d60:	31 c0                	xor    %eax,%eax
+     d62:	eb a5                	jmp    d09 <nulterminate+0x39>
+     d64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+
+00000d70 <parsecmd>:
+{
+     d70:	55                   	push   %ebp
+     d71:	89 e5                	mov    %esp,%ebp
+     d73:	57                   	push   %edi
+     d74:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     d75:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     d78:	53                   	push   %ebx
+     d79:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     d7c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     d7f:	53                   	push   %ebx
+     d80:	e8 6b 01 00 00       	call   ef0 <strlen>
+  cmd = parseline(&s, es);
+     d85:	59                   	pop    %ecx
+     d86:	5e                   	pop    %esi
+  es = s + strlen(s);
+     d87:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     d89:	53                   	push   %ebx
+     d8a:	57                   	push   %edi
+     d8b:	e8 d0 fd ff ff       	call   b60 <parseline>
+  peek(&s, es, "");
+     d90:	83 c4 0c             	add    $0xc,%esp
+     d93:	68 4a 15 00 00       	push   $0x154a
+  cmd = parseline(&s, es);
+     d98:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     d9a:	53                   	push   %ebx
+     d9b:	57                   	push   %edi
+     d9c:	e8 4f fa ff ff       	call   7f0 <peek>
+  if(s != es){
+     da1:	8b 45 08             	mov    0x8(%ebp),%eax
+     da4:	83 c4 10             	add    $0x10,%esp
+     da7:	39 d8                	cmp    %ebx,%eax
+     da9:	75 13                	jne    dbe <parsecmd+0x4e>
+  nulterminate(cmd);
+     dab:	83 ec 0c             	sub    $0xc,%esp
+     dae:	56                   	push   %esi
+     daf:	e8 1c ff ff ff       	call   cd0 <nulterminate>
+}
+     db4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     db7:	89 f0                	mov    %esi,%eax
+     db9:	5b                   	pop    %ebx
+     dba:	5e                   	pop    %esi
+     dbb:	5f                   	pop    %edi
+     dbc:	5d                   	pop    %ebp
+     dbd:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     dbe:	52                   	push   %edx
+     dbf:	50                   	push   %eax
+     dc0:	68 ca 15 00 00       	push   $0x15ca
+     dc5:	6a 02                	push   $0x2
+     dc7:	e8 44 04 00 00       	call   1210 <printf>
+    panic("syntax");
+     dcc:	c7 04 24 8e 15 00 00 	movl   $0x158e,(%esp)
+     dd3:	e8 98 f3 ff ff       	call   170 <panic>
+     dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ddf:	90                   	nop
+
+00000de0 <freecmd>:
+
+// Free a parsed command. The shell parses each line itself now rather
+// than in a child, so it has to give the memory back.
+void
+freecmd(struct cmd *cmd)
+{
+     de0:	55                   	push   %ebp
+     de1:	89 e5                	mov    %esp,%ebp
+     de3:	53                   	push   %ebx
+     de4:	83 ec 04             	sub    $0x4,%esp
+     de7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct backcmd *bcmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     dea:	85 db                	test   %ebx,%ebx
+     dec:	74 62                	je     e50 <freecmd+0x70>
+    return;
+
+  switch(cmd->type){
+     dee:	8b 03                	mov    (%ebx),%eax
+     df0:	83 f8 04             	cmp    $0x4,%eax
+     df3:	74 0c                	je     e01 <freecmd+0x21>
+     df5:	7f 31                	jg     e28 <freecmd+0x48>
+     df7:	83 f8 02             	cmp    $0x2,%eax
+     dfa:	74 31                	je     e2d <freecmd+0x4d>
+     dfc:	83 f8 03             	cmp    $0x3,%eax
+     dff:	75 17                	jne    e18 <freecmd+0x38>
+    freecmd(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    freecmd(lcmd->left);
+     e01:	83 ec 0c             	sub    $0xc,%esp
+     e04:	ff 73 04             	push   0x4(%ebx)
+     e07:	e8 d4 ff ff ff       	call   de0 <freecmd>
+    freecmd(lcmd->right);
+     e0c:	58                   	pop    %eax
+     e0d:	ff 73 08             	push   0x8(%ebx)
+     e10:	e8 cb ff ff ff       	call   de0 <freecmd>
+    break;
+     e15:	83 c4 10             	add    $0x10,%esp
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+    freecmd(bcmd->cmd);
+    break;
+  }
+  free(cmd);
+     e18:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     e1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e1e:	c9                   	leave
+  free(cmd);
+     e1f:	e9 9c 05 00 00       	jmp    13c0 <free>
+     e24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  switch(cmd->type){
+     e28:	83 f8 05             	cmp    $0x5,%eax
+     e2b:	75 eb                	jne    e18 <freecmd+0x38>
+    freecmd(bcmd->cmd);
+     e2d:	83 ec 0c             	sub    $0xc,%esp
+     e30:	ff 73 04             	push   0x4(%ebx)
+     e33:	e8 a8 ff ff ff       	call   de0 <freecmd>
+  free(cmd);
+     e38:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    break;
+     e3b:	83 c4 10             	add    $0x10,%esp
+}
+     e3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e41:	c9                   	leave
+  free(cmd);
+     e42:	e9 79 05 00 00       	jmp    13c0 <free>
+     e47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4e:	66 90                	xchg   %ax,%ax
+}
+     e50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e53:	c9                   	leave
+     e54:	c3                   	ret
+     e55:	66 90                	xchg   %ax,%ax
+     e57:	66 90                	xchg   %ax,%ax
+     e59:	66 90                	xchg   %ax,%ax
+     e5b:	66 90                	xchg   %ax,%ax
+     e5d:	66 90                	xchg   %ax,%ax
+     e5f:	90                   	nop
+
+00000e60 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     e60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     e61:	31 c0                	xor    %eax,%eax
+{
+     e63:	89 e5                	mov    %esp,%ebp
+     e65:	53                   	push   %ebx
+     e66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     e69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     e6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     e70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     e74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     e77:	83 c0 01             	add    $0x1,%eax
+     e7a:	84 d2                	test   %dl,%dl
+     e7c:	75 f2                	jne    e70 <strcpy+0x10>
+    ;
+  return os;
+}
+     e7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e81:	89 c8                	mov    %ecx,%eax
+     e83:	c9                   	leave
+     e84:	c3                   	ret
+     e85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e90 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     e90:	55                   	push   %ebp
+     e91:	89 e5                	mov    %esp,%ebp
+     e93:	53                   	push   %ebx
+     e94:	8b 55 08             	mov    0x8(%ebp),%edx
+     e97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     e9a:	0f b6 02             	movzbl (%edx),%eax
+     e9d:	84 c0                	test   %al,%al
+     e9f:	75 17                	jne    eb8 <strcmp+0x28>
+     ea1:	eb 3a                	jmp    edd <strcmp+0x4d>
+     ea3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ea7:	90                   	nop
+     ea8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     eac:	83 c2 01             	add    $0x1,%edx
+     eaf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     eb2:	84 c0                	test   %al,%al
+     eb4:	74 1a                	je     ed0 <strcmp+0x40>
+    p++, q++;
+     eb6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     eb8:	0f b6 19             	movzbl (%ecx),%ebx
+     ebb:	38 c3                	cmp    %al,%bl
+     ebd:	74 e9                	je     ea8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     ebf:	29 d8                	sub    %ebx,%eax
+}
+     ec1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ec4:	c9                   	leave
+     ec5:	c3                   	ret
+     ec6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ecd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     ed0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     ed4:	31 c0                	xor    %eax,%eax
+     ed6:	29 d8                	sub    %ebx,%eax
+}
+     ed8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     edb:	c9                   	leave
+     edc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     edd:	0f b6 19             	movzbl (%ecx),%ebx
+     ee0:	31 c0                	xor    %eax,%eax
+     ee2:	eb db                	jmp    ebf <strcmp+0x2f>
+     ee4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eef:	90                   	nop
+
+00000ef0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     ef0:	55                   	push   %ebp
+     ef1:	89 e5                	mov    %esp,%ebp
+     ef3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     ef6:	80 3a 00             	cmpb   $0x0,(%edx)
+     ef9:	74 15                	je     f10 <strlen+0x20>
+     efb:	31 c0                	xor    %eax,%eax
+     efd:	8d 76 00             	lea    0x0(%esi),%esi
+     f00:	83 c0 01             	add    $0x1,%eax
+     f03:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     f07:	89 c1                	mov    %eax,%ecx
+     f09:	75 f5                	jne    f00 <strlen+0x10>
+    ;
+  return n;
+}
+     f0b:	89 c8                	mov    %ecx,%eax
+     f0d:	5d                   	pop    %ebp
+     f0e:	c3                   	ret
+     f0f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     f10:	31 c9                	xor    %ecx,%ecx
+}
+     f12:	5d                   	pop    %ebp
+     f13:	89 c8                	mov    %ecx,%eax
+     f15:	c3                   	ret
+     f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f20 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+     f23:	57                   	push   %edi
+     f24:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     f27:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     f2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f2d:	89 d7                	mov    %edx,%edi
+     f2f:	fc                   	cld
+     f30:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     f32:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     f35:	89 d0                	mov    %edx,%eax
+     f37:	c9                   	leave
+     f38:	c3                   	ret
+     f39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f40 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	8b 45 08             	mov    0x8(%ebp),%eax
+     f46:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     f4a:	0f b6 10             	movzbl (%eax),%edx
+     f4d:	84 d2                	test   %dl,%dl
+     f4f:	75 12                	jne    f63 <strchr+0x23>
+     f51:	eb 1d                	jmp    f70 <strchr+0x30>
+     f53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f57:	90                   	nop
+     f58:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     f5c:	83 c0 01             	add    $0x1,%eax
+     f5f:	84 d2                	test   %dl,%dl
+     f61:	74 0d                	je     f70 <strchr+0x30>
+    if(*s == c)
+     f63:	38 d1                	cmp    %dl,%cl
+     f65:	75 f1                	jne    f58 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     f67:	5d                   	pop    %ebp
+     f68:	c3                   	ret
+     f69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     f70:	31 c0                	xor    %eax,%eax
+}
+     f72:	5d                   	pop    %ebp
+     f73:	c3                   	ret
+     f74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f7f:	90                   	nop
+
+00000f80 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	57                   	push   %edi
+     f84:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     f85:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     f88:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     f89:	31 db                	xor    %ebx,%ebx
+{
+     f8b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     f8e:	eb 27                	jmp    fb7 <gets+0x37>
+    cc = read(0, &c, 1);
+     f90:	83 ec 04             	sub    $0x4,%esp
+     f93:	6a 01                	push   $0x1
+     f95:	56                   	push   %esi
+     f96:	6a 00                	push   $0x0
+     f98:	e8 1e 01 00 00       	call   10bb <read>
+    if(cc < 1)
+     f9d:	83 c4 10             	add    $0x10,%esp
+     fa0:	85 c0                	test   %eax,%eax
+     fa2:	7e 1d                	jle    fc1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     fa4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     fa8:	8b 55 08             	mov    0x8(%ebp),%edx
+     fab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     faf:	3c 0a                	cmp    $0xa,%al
+     fb1:	74 10                	je     fc3 <gets+0x43>
+     fb3:	3c 0d                	cmp    $0xd,%al
+     fb5:	74 0c                	je     fc3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     fb7:	89 df                	mov    %ebx,%edi
+     fb9:	83 c3 01             	add    $0x1,%ebx
+     fbc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     fbf:	7c cf                	jl     f90 <gets+0x10>
+     fc1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     fc3:	8b 45 08             	mov    0x8(%ebp),%eax
+     fc6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     fca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fcd:	5b                   	pop    %ebx
+     fce:	5e                   	pop    %esi
+     fcf:	5f                   	pop    %edi
+     fd0:	5d                   	pop    %ebp
+     fd1:	c3                   	ret
+     fd2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000fe0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     fe0:	55                   	push   %ebp
+     fe1:	89 e5                	mov    %esp,%ebp
+     fe3:	56                   	push   %esi
+     fe4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     fe5:	83 ec 08             	sub    $0x8,%esp
+     fe8:	6a 00                	push   $0x0
+     fea:	ff 75 08             	push   0x8(%ebp)
+     fed:	e8 f1 00 00 00       	call   10e3 <open>
+  if(fd < 0)
+     ff2:	83 c4 10             	add    $0x10,%esp
+     ff5:	85 c0                	test   %eax,%eax
+     ff7:	78 27                	js     1020 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     ff9:	83 ec 08             	sub    $0x8,%esp
+     ffc:	ff 75 0c             	push   0xc(%ebp)
+     fff:	89 c3                	mov    %eax,%ebx
+    1001:	50                   	push   %eax
+    1002:	e8 f4 00 00 00       	call   10fb <fstat>
+  close(fd);
+    1007:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    100a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    100c:	e8 ba 00 00 00       	call   10cb <close>
+  return r;
+    1011:	83 c4 10             	add    $0x10,%esp
+}
+    1014:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1017:	89 f0                	mov    %esi,%eax
+    1019:	5b                   	pop    %ebx
+    101a:	5e                   	pop    %esi
+    101b:	5d                   	pop    %ebp
+    101c:	c3                   	ret
+    101d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1020:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1025:	eb ed                	jmp    1014 <stat+0x34>
+    1027:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102e:	66 90                	xchg   %ax,%ax
+
+00001030 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1030:	55                   	push   %ebp
+    1031:	89 e5                	mov    %esp,%ebp
+    1033:	53                   	push   %ebx
+    1034:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1037:	0f be 02             	movsbl (%edx),%eax
+    103a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    103d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1040:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1045:	77 1e                	ja     1065 <atoi+0x35>
+    1047:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    104e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1050:	83 c2 01             	add    $0x1,%edx
+    1053:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1056:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    105a:	0f be 02             	movsbl (%edx),%eax
+    105d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1060:	80 fb 09             	cmp    $0x9,%bl
+    1063:	76 eb                	jbe    1050 <atoi+0x20>
+  return n;
+}
+    1065:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1068:	89 c8                	mov    %ecx,%eax
+    106a:	c9                   	leave
+    106b:	c3                   	ret
+    106c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001070 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	57                   	push   %edi
+    1074:	56                   	push   %esi
+    1075:	8b 45 10             	mov    0x10(%ebp),%eax
+    1078:	8b 55 08             	mov    0x8(%ebp),%edx
+    107b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    107e:	85 c0                	test   %eax,%eax
+    1080:	7e 13                	jle    1095 <memmove+0x25>
+    1082:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1084:	89 d7                	mov    %edx,%edi
+    1086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1090:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1091:	39 f8                	cmp    %edi,%eax
+    1093:	75 fb                	jne    1090 <memmove+0x20>
+  return vdst;
+}
+    1095:	5e                   	pop    %esi
+    1096:	89 d0                	mov    %edx,%eax
+    1098:	5f                   	pop    %edi
+    1099:	5d                   	pop    %ebp
+    109a:	c3                   	ret
+
+0000109b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    109b:	b8 01 00 00 00       	mov    $0x1,%eax
+    10a0:	cd 40                	int    $0x40
+    10a2:	c3                   	ret
+
+000010a3 <exit>:
+SYSCALL(exit)
+    10a3:	b8 02 00 00 00       	mov    $0x2,%eax
+    10a8:	cd 40                	int    $0x40
+    10aa:	c3                   	ret
+
+000010ab <wait>:
+SYSCALL(wait)
+    10ab:	b8 03 00 00 00       	mov    $0x3,%eax
+    10b0:	cd 40                	int    $0x40
+    10b2:	c3                   	ret
+
+000010b3 <pipe>:
+SYSCALL(pipe)
+    10b3:	b8 04 00 00 00       	mov    $0x4,%eax
+    10b8:	cd 40                	int    $0x40
+    10ba:	c3                   	ret
+
+000010bb <read>:
+SYSCALL(read)
+    10bb:	b8 05 00 00 00       	mov    $0x5,%eax
+    10c0:	cd 40                	int    $0x40
+    10c2:	c3                   	ret
+
+000010c3 <write>:
+SYSCALL(write)
+    10c3:	b8 10 00 00 00       	mov    $0x10,%eax
+    10c8:	cd 40                	int    $0x40
+    10ca:	c3                   	ret
+
+000010cb <close>:
+SYSCALL(close)
+    10cb:	b8 15 00 00 00       	mov    $0x15,%eax
+    10d0:	cd 40                	int    $0x40
+    10d2:	c3                   	ret
+
+000010d3 <kill>:
+SYSCALL(kill)
+    10d3:	b8 06 00 00 00       	mov    $0x6,%eax
+    10d8:	cd 40                	int    $0x40
+    10da:	c3                   	ret
+
+000010db <exec>:
+SYSCALL(exec)
+    10db:	b8 07 00 00 00       	mov    $0x7,%eax
+    10e0:	cd 40                	int    $0x40
+    10e2:	c3                   	ret
+
+000010e3 <open>:
+SYSCALL(open)
+    10e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    10e8:	cd 40                	int    $0x40
+    10ea:	c3                   	ret
+
+000010eb <mknod>:
+SYSCALL(mknod)
+    10eb:	b8 11 00 00 00       	mov    $0x11,%eax
+    10f0:	cd 40                	int    $0x40
+    10f2:	c3                   	ret
+
+000010f3 <unlink>:
+SYSCALL(unlink)
+    10f3:	b8 12 00 00 00       	mov    $0x12,%eax
+    10f8:	cd 40                	int    $0x40
+    10fa:	c3                   	ret
+
+000010fb <fstat>:
+SYSCALL(fstat)
+    10fb:	b8 08 00 00 00       	mov    $0x8,%eax
+    1100:	cd 40                	int    $0x40
+    1102:	c3                   	ret
+
+00001103 <link>:
+SYSCALL(link)
+    1103:	b8 13 00 00 00       	mov    $0x13,%eax
+    1108:	cd 40                	int    $0x40
+    110a:	c3                   	ret
+
+0000110b <mkdir>:
+SYSCALL(mkdir)
+    110b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1110:	cd 40                	int    $0x40
+    1112:	c3                   	ret
+
+00001113 <chdir>:
+SYSCALL(chdir)
+    1113:	b8 09 00 00 00       	mov    $0x9,%eax
+    1118:	cd 40                	int    $0x40
+    111a:	c3                   	ret
+
+0000111b <dup>:
+SYSCALL(dup)
+    111b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1120:	cd 40                	int    $0x40
+    1122:	c3                   	ret
+
+00001123 <getpid>:
+SYSCALL(getpid)
+    1123:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1128:	cd 40                	int    $0x40
+    112a:	c3                   	ret
+
+0000112b <sbrk>:
+SYSCALL(sbrk)
+    112b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1130:	cd 40                	int    $0x40
+    1132:	c3                   	ret
+
+00001133 <sleep>:
+SYSCALL(sleep)
+    1133:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1138:	cd 40                	int    $0x40
+    113a:	c3                   	ret
+
+0000113b <uptime>:
+SYSCALL(uptime)
+    113b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1140:	cd 40                	int    $0x40
+    1142:	c3                   	ret
+
+00001143 <getrss>:
+SYSCALL(getrss)
+    1143:	b8 16 00 00 00       	mov    $0x16,%eax
+    1148:	cd 40                	int    $0x40
+    114a:	c3                   	ret
+
+0000114b <getNumFreePages>:
+SYSCALL(getNumFreePages)
+    114b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1150:	cd 40                	int    $0x40
+    1152:	c3                   	ret
+
+00001153 <getvmstat>:
+SYSCALL(getvmstat)
+    1153:	b8 18 00 00 00       	mov    $0x18,%eax
+    1158:	cd 40                	int    $0x40
+    115a:	c3                   	ret
+
+0000115b <vmctl>:
+SYSCALL(vmctl)
+    115b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1160:	cd 40                	int    $0x40
+    1162:	c3                   	ret
+
+00001163 <spawn>:
+SYSCALL(spawn)
+    1163:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1168:	cd 40                	int    $0x40
+    116a:	c3                   	ret
+    116b:	66 90                	xchg   %ax,%ax
+    116d:	66 90                	xchg   %ax,%ax
+    116f:	90                   	nop
+
+00001170 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	57                   	push   %edi
+    1174:	56                   	push   %esi
+    1175:	53                   	push   %ebx
+    1176:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1178:	89 d1                	mov    %edx,%ecx
+{
+    117a:	83 ec 3c             	sub    $0x3c,%esp
+    117d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1180:	85 d2                	test   %edx,%edx
+    1182:	0f 89 80 00 00 00    	jns    1208 <printint+0x98>
+    1188:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    118c:	74 7a                	je     1208 <printint+0x98>
+    x = -xx;
+    118e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1190:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1195:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1198:	31 f6                	xor    %esi,%esi
+    119a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    11a0:	89 c8                	mov    %ecx,%eax
+    11a2:	31 d2                	xor    %edx,%edx
+    11a4:	89 f7                	mov    %esi,%edi
+    11a6:	f7 f3                	div    %ebx
+    11a8:	8d 76 01             	lea    0x1(%esi),%esi
+    11ab:	0f b6 92 80 16 00 00 	movzbl 0x1680(%edx),%edx
+    11b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    11b6:	89 ca                	mov    %ecx,%edx
+    11b8:	89 c1                	mov    %eax,%ecx
+    11ba:	39 da                	cmp    %ebx,%edx
+    11bc:	73 e2                	jae    11a0 <printint+0x30>
+  if(neg)
+    11be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    11c1:	85 c0                	test   %eax,%eax
+    11c3:	74 07                	je     11cc <printint+0x5c>
+    buf[i++] = '-';
+    11c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    11ca:	89 f7                	mov    %esi,%edi
+    11cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    11cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    11d2:	01 df                	add    %ebx,%edi
+    11d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    11d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    11db:	83 ec 04             	sub    $0x4,%esp
+    11de:	88 45 d7             	mov    %al,-0x29(%ebp)
+    11e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    11e4:	6a 01                	push   $0x1
+    11e6:	50                   	push   %eax
+    11e7:	56                   	push   %esi
+    11e8:	e8 d6 fe ff ff       	call   10c3 <write>
+  while(--i >= 0)
+    11ed:	89 f8                	mov    %edi,%eax
+    11ef:	83 c4 10             	add    $0x10,%esp
+    11f2:	83 ef 01             	sub    $0x1,%edi
+    11f5:	39 d8                	cmp    %ebx,%eax
+    11f7:	75 df                	jne    11d8 <printint+0x68>
+}
+    11f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11fc:	5b                   	pop    %ebx
+    11fd:	5e                   	pop    %esi
+    11fe:	5f                   	pop    %edi
+    11ff:	5d                   	pop    %ebp
+    1200:	c3                   	ret
+    1201:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1208:	31 c0                	xor    %eax,%eax
+    120a:	eb 89                	jmp    1195 <printint+0x25>
+    120c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001210 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1210:	55                   	push   %ebp
+    1211:	89 e5                	mov    %esp,%ebp
+    1213:	57                   	push   %edi
+    1214:	56                   	push   %esi
+    1215:	53                   	push   %ebx
+    1216:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1219:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    121c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    121f:	0f b6 1e             	movzbl (%esi),%ebx
+    1222:	83 c6 01             	add    $0x1,%esi
+    1225:	84 db                	test   %bl,%bl
+    1227:	74 67                	je     1290 <printf+0x80>
+    1229:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    122c:	31 d2                	xor    %edx,%edx
+    122e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1231:	eb 34                	jmp    1267 <printf+0x57>
+    1233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1237:	90                   	nop
+    1238:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    123b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1240:	83 f8 25             	cmp    $0x25,%eax
+    1243:	74 18                	je     125d <printf+0x4d>
+  write(fd, &c, 1);
+    1245:	83 ec 04             	sub    $0x4,%esp
+    1248:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    124b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    124e:	6a 01                	push   $0x1
+    1250:	50                   	push   %eax
+    1251:	57                   	push   %edi
+    1252:	e8 6c fe ff ff       	call   10c3 <write>
+    1257:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    125a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    125d:	0f b6 1e             	movzbl (%esi),%ebx
+    1260:	83 c6 01             	add    $0x1,%esi
+    1263:	84 db                	test   %bl,%bl
+    1265:	74 29                	je     1290 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1267:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    126a:	85 d2                	test   %edx,%edx
+    126c:	74 ca                	je     1238 <printf+0x28>
+      }
+    } else if(state == '%'){
+    126e:	83 fa 25             	cmp    $0x25,%edx
+    1271:	75 ea                	jne    125d <printf+0x4d>
+      if(c == 'd'){
+    1273:	83 f8 25             	cmp    $0x25,%eax
+    1276:	0f 84 24 01 00 00    	je     13a0 <printf+0x190>
+    127c:	83 e8 63             	sub    $0x63,%eax
+    127f:	83 f8 15             	cmp    $0x15,%eax
+    1282:	77 1c                	ja     12a0 <printf+0x90>
+    1284:	ff 24 85 28 16 00 00 	jmp    *0x1628(,%eax,4)
+    128b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    128f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1293:	5b                   	pop    %ebx
+    1294:	5e                   	pop    %esi
+    1295:	5f                   	pop    %edi
+    1296:	5d                   	pop    %ebp
+    1297:	c3                   	ret
+    1298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129f:	90                   	nop
+  write(fd, &c, 1);
+    12a0:	83 ec 04             	sub    $0x4,%esp
+    12a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    12a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    12aa:	6a 01                	push   $0x1
+    12ac:	52                   	push   %edx
+    12ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    12b0:	57                   	push   %edi
+    12b1:	e8 0d fe ff ff       	call   10c3 <write>
+    12b6:	83 c4 0c             	add    $0xc,%esp
+    12b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    12bc:	6a 01                	push   $0x1
+    12be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    12c1:	52                   	push   %edx
+    12c2:	57                   	push   %edi
+    12c3:	e8 fb fd ff ff       	call   10c3 <write>
+        putc(fd, c);
+    12c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    12cb:	31 d2                	xor    %edx,%edx
+    12cd:	eb 8e                	jmp    125d <printf+0x4d>
+    12cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    12d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    12d3:	83 ec 0c             	sub    $0xc,%esp
+    12d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    12db:	8b 13                	mov    (%ebx),%edx
+    12dd:	6a 00                	push   $0x0
+    12df:	89 f8                	mov    %edi,%eax
+        ap++;
+    12e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    12e4:	e8 87 fe ff ff       	call   1170 <printint>
+        ap++;
+    12e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    12ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    12ef:	31 d2                	xor    %edx,%edx
+    12f1:	e9 67 ff ff ff       	jmp    125d <printf+0x4d>
+    12f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1300:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1303:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1305:	83 c0 04             	add    $0x4,%eax
+    1308:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    130b:	85 db                	test   %ebx,%ebx
+    130d:	0f 84 9d 00 00 00    	je     13b0 <printf+0x1a0>
+        while(*s != 0){
+    1313:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1316:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1318:	84 c0                	test   %al,%al
+    131a:	0f 84 3d ff ff ff    	je     125d <printf+0x4d>
+    1320:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1323:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1326:	89 de                	mov    %ebx,%esi
+    1328:	89 d3                	mov    %edx,%ebx
+    132a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1330:	83 ec 04             	sub    $0x4,%esp
+    1333:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1336:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1339:	6a 01                	push   $0x1
+    133b:	53                   	push   %ebx
+    133c:	57                   	push   %edi
+    133d:	e8 81 fd ff ff       	call   10c3 <write>
+        while(*s != 0){
+    1342:	0f b6 06             	movzbl (%esi),%eax
+    1345:	83 c4 10             	add    $0x10,%esp
+    1348:	84 c0                	test   %al,%al
+    134a:	75 e4                	jne    1330 <printf+0x120>
+      state = 0;
+    134c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    134f:	31 d2                	xor    %edx,%edx
+    1351:	e9 07 ff ff ff       	jmp    125d <printf+0x4d>
+    1356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    135d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1360:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1363:	83 ec 0c             	sub    $0xc,%esp
+    1366:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    136b:	8b 13                	mov    (%ebx),%edx
+    136d:	6a 01                	push   $0x1
+    136f:	e9 6b ff ff ff       	jmp    12df <printf+0xcf>
+    1374:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1378:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    137b:	83 ec 04             	sub    $0x4,%esp
+    137e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1381:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1383:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1386:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1389:	6a 01                	push   $0x1
+    138b:	52                   	push   %edx
+    138c:	57                   	push   %edi
+    138d:	e8 31 fd ff ff       	call   10c3 <write>
+        ap++;
+    1392:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1395:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1398:	31 d2                	xor    %edx,%edx
+    139a:	e9 be fe ff ff       	jmp    125d <printf+0x4d>
+    139f:	90                   	nop
+  write(fd, &c, 1);
+    13a0:	83 ec 04             	sub    $0x4,%esp
+    13a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    13a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    13a9:	6a 01                	push   $0x1
+    13ab:	e9 11 ff ff ff       	jmp    12c1 <printf+0xb1>
+    13b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    13b5:	bb 20 16 00 00       	mov    $0x1620,%ebx
+    13ba:	e9 61 ff ff ff       	jmp    1320 <printf+0x110>
+    13bf:	90                   	nop
+
+000013c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    13c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    13c1:	a1 24 1d 00 00       	mov    0x1d24,%eax
+{
+    13c6:	89 e5                	mov    %esp,%ebp
+    13c8:	57                   	push   %edi
+    13c9:	56                   	push   %esi
+    13ca:	53                   	push   %ebx
+    13cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    13ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    13d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    13da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    13dc:	39 ca                	cmp    %ecx,%edx
+    13de:	73 30                	jae    1410 <free+0x50>
+    13e0:	39 c1                	cmp    %eax,%ecx
+    13e2:	72 04                	jb     13e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    13e4:	39 c2                	cmp    %eax,%edx
+    13e6:	72 f0                	jb     13d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    13e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    13eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    13ee:	39 f8                	cmp    %edi,%eax
+    13f0:	74 2e                	je     1420 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    13f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    13f5:	8b 42 04             	mov    0x4(%edx),%eax
+    13f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    13fb:	39 f1                	cmp    %esi,%ecx
+    13fd:	74 38                	je     1437 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    13ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1401:	5b                   	pop    %ebx
+  freep = p;
+    1402:	89 15 24 1d 00 00    	mov    %edx,0x1d24
+}
+    1408:	5e                   	pop    %esi
+    1409:	5f                   	pop    %edi
+    140a:	5d                   	pop    %ebp
+    140b:	c3                   	ret
+    140c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1410:	39 c1                	cmp    %eax,%ecx
+    1412:	72 d0                	jb     13e4 <free+0x24>
+    1414:	eb c2                	jmp    13d8 <free+0x18>
+    1416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1420:	03 70 04             	add    0x4(%eax),%esi
+    1423:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1426:	8b 02                	mov    (%edx),%eax
+    1428:	8b 00                	mov    (%eax),%eax
+    142a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    142d:	8b 42 04             	mov    0x4(%edx),%eax
+    1430:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1433:	39 f1                	cmp    %esi,%ecx
+    1435:	75 c8                	jne    13ff <free+0x3f>
+    p->s.size += bp->s.size;
+    1437:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    143a:	89 15 24 1d 00 00    	mov    %edx,0x1d24
+    p->s.size += bp->s.size;
+    1440:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1443:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1446:	89 0a                	mov    %ecx,(%edx)
+}
+    1448:	5b                   	pop    %ebx
+    1449:	5e                   	pop    %esi
+    144a:	5f                   	pop    %edi
+    144b:	5d                   	pop    %ebp
+    144c:	c3                   	ret
+    144d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001450 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1450:	55                   	push   %ebp
+    1451:	89 e5                	mov    %esp,%ebp
+    1453:	57                   	push   %edi
+    1454:	56                   	push   %esi
+    1455:	53                   	push   %ebx
+    1456:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1459:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    145c:	8b 15 24 1d 00 00    	mov    0x1d24,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1462:	8d 78 07             	lea    0x7(%eax),%edi
+    1465:	c1 ef 03             	shr    $0x3,%edi
+    1468:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    146b:	85 d2                	test   %edx,%edx
+    146d:	0f 84 8d 00 00 00    	je     1500 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1473:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1475:	8b 48 04             	mov    0x4(%eax),%ecx
+    1478:	39 f9                	cmp    %edi,%ecx
+    147a:	73 64                	jae    14e0 <malloc+0x90>
+  if(nu < 4096)
+    147c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1481:	39 df                	cmp    %ebx,%edi
+    1483:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1486:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    148d:	eb 0a                	jmp    1499 <malloc+0x49>
+    148f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1490:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1492:	8b 48 04             	mov    0x4(%eax),%ecx
+    1495:	39 f9                	cmp    %edi,%ecx
+    1497:	73 47                	jae    14e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1499:	89 c2                	mov    %eax,%edx
+    149b:	39 05 24 1d 00 00    	cmp    %eax,0x1d24
+    14a1:	75 ed                	jne    1490 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    14a3:	83 ec 0c             	sub    $0xc,%esp
+    14a6:	56                   	push   %esi
+    14a7:	e8 7f fc ff ff       	call   112b <sbrk>
+  if(p == (char*)-1)
+    14ac:	83 c4 10             	add    $0x10,%esp
+    14af:	83 f8 ff             	cmp    $0xffffffff,%eax
+    14b2:	74 1c                	je     14d0 <malloc+0x80>
+  hp->s.size = nu;
+    14b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    14b7:	83 ec 0c             	sub    $0xc,%esp
+    14ba:	83 c0 08             	add    $0x8,%eax
+    14bd:	50                   	push   %eax
+    14be:	e8 fd fe ff ff       	call   13c0 <free>
+  return freep;
+    14c3:	8b 15 24 1d 00 00    	mov    0x1d24,%edx
+      if((p = morecore(nunits)) == 0)
+    14c9:	83 c4 10             	add    $0x10,%esp
+    14cc:	85 d2                	test   %edx,%edx
+    14ce:	75 c0                	jne    1490 <malloc+0x40>
+        return 0;
+  }
+}
+    14d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    14d3:	31 c0                	xor    %eax,%eax
+}
+    14d5:	5b                   	pop    %ebx
+    14d6:	5e                   	pop    %esi
+    14d7:	5f                   	pop    %edi
+    14d8:	5d                   	pop    %ebp
+    14d9:	c3                   	ret
+    14da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    14e0:	39 cf                	cmp    %ecx,%edi
+    14e2:	74 4c                	je     1530 <malloc+0xe0>
+        p->s.size -= nunits;
+    14e4:	29 f9                	sub    %edi,%ecx
+    14e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    14e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    14ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    14ef:	89 15 24 1d 00 00    	mov    %edx,0x1d24
+}
+    14f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    14f8:	83 c0 08             	add    $0x8,%eax
+}
+    14fb:	5b                   	pop    %ebx
+    14fc:	5e                   	pop    %esi
+    14fd:	5f                   	pop    %edi
+    14fe:	5d                   	pop    %ebp
+    14ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1500:	c7 05 24 1d 00 00 28 	movl   $0x1d28,0x1d24
+    1507:	1d 00 00 
+    base.s.size = 0;
+    150a:	b8 28 1d 00 00       	mov    $0x1d28,%eax
+    base.s.ptr = freep = prevp = &base;
+    150f:	c7 05 28 1d 00 00 28 	movl   $0x1d28,0x1d28
+    1516:	1d 00 00 
+    base.s.size = 0;
+    1519:	c7 05 2c 1d 00 00 00 	movl   $0x0,0x1d2c
+    1520:	00 00 00 
+    if(p->s.size >= nunits){
+    1523:	e9 54 ff ff ff       	jmp    147c <malloc+0x2c>
+    1528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    152f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1530:	8b 08                	mov    (%eax),%ecx
+    1532:	89 0a                	mov    %ecx,(%edx)
+    1534:	eb b9                	jmp    14ef <malloc+0x9f>
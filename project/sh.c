@@ -3,6 +3,7 @@
 #include "types.h"
 #include "user.h"
 #include "fcntl.h"
+#include "spawn.h"
 
 // Parsed command representation
 #define EXEC  1
@@ -50,6 +51,8 @@ struct backcmd {
 };
 
 int fork1(void);  // Fork but panics on failure.
+int startcmd(struct cmd*, struct spawn_action*, int);
+void freecmd(struct cmd*);
 void panic(char*);
 struct cmd *parsecmd(char*);
 
@@ -57,7 +60,8 @@ struct cmd *parsecmd(char*);
 void
 runcmd(struct cmd *cmd)
 {
-  int p[2];
+  int p[2], n;
+  struct spawn_action act[3];
   struct backcmd *bcmd;
   struct execcmd *ecmd;
   struct listcmd *lcmd;
@@ -91,9 +95,8 @@ runcmd(struct cmd *cmd)
 
   case LIST:
     lcmd = (struct listcmd*)cmd;
-    if(fork1() == 0)
-      runcmd(lcmd->left);
-    wait();
+    if(startcmd(lcmd->left, 0, 0) >= 0)
+      wait();
     runcmd(lcmd->right);
     break;
 
@@ -101,30 +104,25 @@ runcmd(struct cmd *cmd)
     pcmd = (struct pipecmd*)cmd;
     if(pipe(p) < 0)
       panic("pipe");
-    if(fork1() == 0){
-      close(1);
-      dup(p[1]);
-      close(p[0]);
-      close(p[1]);
-      runcmd(pcmd->left);
-    }
-    if(fork1() == 0){
-      close(0);
-      dup(p[0]);
-      close(p[0]);
-      close(p[1]);
-      runcmd(pcmd->right);
-    }
+    act[1].type = act[2].type = SPAWN_CLOSE;
+    act[1].fd = p[0];
+    act[2].fd = p[1];
+    act[0].type = SPAWN_DUP2;
+    act[0].fd = 1;
+    act[0].arg = p[1];
+    n = startcmd(pcmd->left, act, 3) >= 0;
+    act[0].fd = 0;
+    act[0].arg = p[0];
+    n += startcmd(pcmd->right, act, 3) >= 0;
     close(p[0]);
     close(p[1]);
-    wait();
-    wait();
+    while(n-- > 0)
+      wait();
     break;
 
   case BACK:
     bcmd = (struct backcmd*)cmd;
-    if(fork1() == 0)
-      runcmd(bcmd->cmd);
+    startcmd(bcmd->cmd, 0, 0);
     break;
   }
   exit();
@@ -145,6 +143,7 @@ int
 main(void)
 {
   static char buf[100];
+  struct cmd *cmd;
   int fd;
 
   // Ensure that three file descriptors are open.
@@ -164,9 +163,11 @@ main(void)
         printf(2, "cannot cd %s\n", buf+3);
       continue;
     }
-    if(fork1() == 0)
-      runcmd(parsecmd(buf));
-    wait();
+    if((cmd = parsecmd(buf)) == 0)
+      continue;
+    if(startcmd(cmd, 0, 0) >= 0)
+      wait();
+    freecmd(cmd);
   }
   exit();
 }
@@ -178,6 +179,51 @@ panic(char *s)
   exit();
 }
 
+// Start cmd in a child, with the file actions act[0..nact) applied
+// first. A plain command, after any redirections, is started with
+// spawn so the shell's memory is never copied; anything else needs a
+// forked copy of the shell to run it. Returns the child's pid, or -1.
+int
+startcmd(struct cmd *cmd, struct spawn_action *act, int nact)
+{
+  struct spawn_action acts[SPAWN_MAXACT];
+  struct redircmd *rcmd;
+  struct execcmd *ecmd;
+  int i, pid;
+
+  for(i = 0; i < nact; i++)
+    acts[i] = act[i];
+  while(cmd->type == REDIR && nact < SPAWN_MAXACT){
+    rcmd = (struct redircmd*)cmd;
+    acts[nact].type = SPAWN_OPEN;
+    acts[nact].fd = rcmd->fd;
+    acts[nact].arg = rcmd->mode;
+    acts[nact].path = rcmd->file;
+    nact++;
+    cmd = rcmd->cmd;
+  }
+  ecmd = (struct execcmd*)cmd;
+  if(cmd->type == EXEC && ecmd->argv[0] != 0){
+    if((pid = spawn(ecmd->argv[0], ecmd->argv, acts, nact)) < 0)
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+    return pid;
+  }
+
+  if((pid = fork1()) == 0){
+    for(i = 0; i < nact; i++){
+      close(acts[i].fd);
+      if(acts[i].type == SPAWN_DUP2)
+        dup(acts[i].arg);
+      else if(acts[i].type == SPAWN_OPEN && open(acts[i].path, acts[i].arg) < 0){
+        printf(2, "open %s failed\n", acts[i].path);
+        exit();
+      }
+    }
+    runcmd(cmd);
+  }
+  return pid;
+}
+
 int
 fork1(void)
 {
@@ -324,18 +370,38 @@ struct cmd *parsepipe(char**, char*);
 struct cmd *parseexec(char**, char*);
 struct cmd *nulterminate(struct cmd*);
 
+// The shell parses in its own process, so a syntax error must not
+// exit. The parsers record the first error here and stop consuming
+// the construct at fault; parsecmd() reports it.
+static char *syntaxerr;
+
+static void
+syntax(char *s)
+{
+  if(syntaxerr == 0)
+    syntaxerr = s;
+}
+
+// Parse a command line. Returns 0 after printing a message if it
+// is malformed.
 struct cmd*
 parsecmd(char *s)
 {
   char *es;
   struct cmd *cmd;
 
+  syntaxerr = 0;
   es = s + strlen(s);
   cmd = parseline(&s, es);
   peek(&s, es, "");
-  if(s != es){
+  if(s != es && syntaxerr == 0){
     printf(2, "leftovers: %s\n", s);
-    panic("syntax");
+    syntax("syntax");
+  }
+  if(syntaxerr){
+    printf(2, "%s\n", syntaxerr);
+    freecmd(cmd);
+    return 0;
   }
   nulterminate(cmd);
   return cmd;
@@ -379,8 +445,10 @@ parseredirs(struct cmd *cmd, char **ps, char *es)
 
   while(peek(ps, es, "<>")){
     tok = gettoken(ps, es, 0, 0);
-    if(gettoken(ps, es, &q, &eq) != 'a')
-      panic("missing file for redirection");
+    if(gettoken(ps, es, &q, &eq) != 'a'){
+      syntax("missing file for redirection");
+      break;
+    }
     switch(tok){
     case '<':
       cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
@@ -405,8 +473,10 @@ parseblock(char **ps, char *es)
     panic("parseblock");
   gettoken(ps, es, 0, 0);
   cmd = parseline(ps, es);
-  if(!peek(ps, es, ")"))
-    panic("syntax - missing )");
+  if(!peek(ps, es, ")")){
+    syntax("syntax - missing )");
+    return cmd;
+  }
   gettoken(ps, es, 0, 0);
   cmd = parseredirs(cmd, ps, es);
   return cmd;
@@ -431,13 +501,18 @@ parseexec(char **ps, char *es)
   while(!peek(ps, es, "|)&;")){
     if((tok=gettoken(ps, es, &q, &eq)) == 0)
       break;
-    if(tok != 'a')
-      panic("syntax");
+    if(tok != 'a'){
+      syntax("syntax");
+      break;
+    }
     cmd->argv[argc] = q;
     cmd->eargv[argc] = eq;
     argc++;
-    if(argc >= MAXARGS)
-      panic("too many args");
+    if(argc >= MAXARGS){
+      syntax("too many args");
+      argc--;
+      break;
+    }
     ret = parseredirs(ret, ps, es);
   }
   cmd->argv[argc] = 0;
@@ -491,3 +566,42 @@ nulterminate(struct cmd *cmd)
   }
   return cmd;
 }
+
+// Free a parsed command. The shell parses each line itself now rather
+// than in a child, so it has to give the memory back.
+void
+freecmd(struct cmd *cmd)
+{
+  struct backcmd *bcmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+    return;
+
+  switch(cmd->type){
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+    freecmd(rcmd->cmd);
+    break;
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+    freecmd(pcmd->left);
+    freecmd(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    freecmd(lcmd->left);
+    freecmd(lcmd->right);
+    break;
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+    freecmd(bcmd->cmd);
+    break;
+  }
+  free(cmd);
+}
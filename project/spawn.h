@@ -0,0 +1,14 @@
+// File actions for spawn(), applied in order to a copy of the
+// caller's open files to make the child's.
+#define SPAWN_OPEN  1  // open path with mode arg as fd
+#define SPAWN_DUP2  2  // make fd a duplicate of fd arg
+#define SPAWN_CLOSE 3  // close fd
+
+#define SPAWN_MAXACT 8  // most actions per spawn()
+
+struct spawn_action {
+  int type;
+  int fd;
+  int arg;
+  char *path;  // SPAWN_OPEN only
+};
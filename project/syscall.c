@@ -54,9 +54,10 @@ argint(int n, int *ip)
 
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
+// lies within the process address space. Set write if the kernel
+// will store into the block.
 int
-argptr(int n, char **pp, int size)
+argptr(int n, char **pp, int size, int write)
 {
   int i;
   struct proc *curproc = myproc();
@@ -65,6 +66,11 @@ argptr(int n, char **pp, int size)
     return -1;
   if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
     return -1;
+  // The buffer may be used with a spinlock held (e.g. by pipewrite or
+  // consoleread), so make sure lazily allocated or swapped pages are
+  // present now, and private and writable if the kernel writes to them.
+  if(uvmprefault(i, size, write) < 0)
+    return -1;
   *pp = (char*)i;
   return 0;
 }
@@ -105,6 +111,9 @@ extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_getrss(void);
 extern int sys_getNumFreePages(void);
+extern int sys_getvmstat(void);
+extern int sys_vmctl(void);
+extern int sys_spawn(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -130,6 +139,9 @@ static int (*syscalls[])(void) = {
 [SYS_close]   sys_close,
 [SYS_getrss] sys_getrss,
 [SYS_getNumFreePages]   sys_getNumFreePages,
+[SYS_getvmstat] sys_getvmstat,
+[SYS_vmctl]    sys_vmctl,
+[SYS_spawn]    sys_spawn,
 };
 
 void
@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "vmstat.h"
 
 
 int
@@ -14,6 +15,49 @@ sys_getNumFreePages(void)
   return num_of_FreePages();  
 }
 
+int
+sys_getvmstat(void)
+{
+  struct vmstat *st, s;
+
+  if(argptr(0, (void*)&st, sizeof(*st), 1) < 0)
+    return -1;
+  memset(&s, 0, sizeof(s));
+  kmemstat(&s);
+  vmfaultstat(&s);
+  pcachestat(&s);
+  ksmstat(&s);
+  zswapstat(&s);
+  swapstat(&s);
+  bcachestat(&s);
+  memmove(st, &s, sizeof(s));
+  return 0;
+}
+
+// Tune the virtual memory system. Returns the previous setting.
+int
+sys_vmctl(void)
+{
+  int cmd, arg, old;
+
+  if(argint(0, &cmd) < 0 || argint(1, &arg) < 0)
+    return -1;
+  switch(cmd){
+  case VMCTL_HEAPMODE:
+    if(arg != HEAP_ZERO && arg != HEAP_LAZY && arg != HEAP_EAGER)
+      return -1;
+    old = myproc()->heapmode;
+    myproc()->heapmode = arg;
+    return old;
+  case VMCTL_KSM_PAGES:
+  case VMCTL_KSM_SLEEP:
+    return ksmctl(cmd, arg);
+  case VMCTL_SWAPPOLICY:
+    return swap_setpolicy(arg);
+  }
+  return -1;
+}
+
 int 
 sys_getrss()
 {
@@ -0,0 +1,1450 @@
+
+_testcow3:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+	exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 0c             	sub    $0xc,%esp
+	printf(1, "Test starting...\n");
+  11:	68 74 0a 00 00       	push   $0xa74
+  16:	6a 01                	push   $0x1
+  18:	e8 a3 06 00 00       	call   6c0 <printf>
+	test();
+  1d:	e8 3e 00 00 00       	call   60 <test>
+  22:	66 90                	xchg   %ax,%ax
+  24:	66 90                	xchg   %ax,%ax
+  26:	66 90                	xchg   %ax,%ax
+  28:	66 90                	xchg   %ax,%ax
+  2a:	66 90                	xchg   %ax,%ax
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <processing>:
+processing(int *x) {
+  30:	55                   	push   %ebp
+  31:	89 e5                	mov    %esp,%ebp
+  33:	83 ec 0c             	sub    $0xc,%esp
+  36:	8b 45 08             	mov    0x8(%ebp),%eax
+  39:	c7 00 ae ad 01 00    	movl   $0x1adae,(%eax)
+    printf(1, "done processing %d\n", x);
+  3f:	50                   	push   %eax
+  40:	68 e8 09 00 00       	push   $0x9e8
+  45:	6a 01                	push   $0x1
+  47:	e8 74 06 00 00       	call   6c0 <printf>
+}
+  4c:	83 c4 10             	add    $0x10,%esp
+  4f:	c9                   	leave
+  50:	c3                   	ret
+  51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5f:	90                   	nop
+
+00000060 <test>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	57                   	push   %edi
+  64:	56                   	push   %esi
+  65:	53                   	push   %ebx
+  66:	83 ec 2c             	sub    $0x2c,%esp
+    uint prev_free_pages = getNumFreePages();
+  69:	e8 8d 05 00 00       	call   5fb <getNumFreePages>
+    char *m1 = (char*)malloc(size);
+  6e:	83 ec 0c             	sub    $0xc,%esp
+    long long size = ((prev_free_pages - 20) * 4 * 1024) / 2; // 20 pages will be used by kernel to create kstack, and process related datastructures.
+  71:	8d 70 ec             	lea    -0x14(%eax),%esi
+  74:	c1 e6 0c             	shl    $0xc,%esi
+  77:	d1 ee                	shr    %esi
+    char *m1 = (char*)malloc(size);
+  79:	56                   	push   %esi
+  7a:	e8 81 08 00 00       	call   900 <malloc>
+    if (m1 == 0) goto out_of_memory;
+  7f:	83 c4 10             	add    $0x10,%esp
+  82:	85 c0                	test   %eax,%eax
+  84:	0f 84 ac 01 00 00    	je     236 <test+0x1d6>
+    printf(1, "\n*** Forking ***\n");
+  8a:	83 ec 08             	sub    $0x8,%esp
+  8d:	89 c3                	mov    %eax,%ebx
+  8f:	68 26 0a 00 00       	push   $0xa26
+  94:	6a 01                	push   $0x1
+  96:	e8 25 06 00 00       	call   6c0 <printf>
+    pid = fork();
+  9b:	e8 ab 04 00 00       	call   54b <fork>
+    if (pid < 0) goto fork_failed; // Fork failed
+  a0:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  a3:	89 c7                	mov    %eax,%edi
+    if (pid < 0) goto fork_failed; // Fork failed
+  a5:	85 c0                	test   %eax,%eax
+  a7:	0f 88 95 01 00 00    	js     242 <test+0x1e2>
+    long long size = ((prev_free_pages - 20) * 4 * 1024) / 2; // 20 pages will be used by kernel to create kstack, and process related datastructures.
+  ad:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  b0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    if (pid == 0) { // Child process
+  b7:	0f 85 cd 00 00 00    	jne    18a <test+0x12a>
+        printf(1, "\n*** Child ***\n");
+  bd:	51                   	push   %ecx
+  be:	51                   	push   %ecx
+  bf:	68 53 0a 00 00       	push   $0xa53
+  c4:	6a 01                	push   $0x1
+  c6:	e8 f5 05 00 00       	call   6c0 <printf>
+        prev_free_pages = getNumFreePages();
+  cb:	e8 2b 05 00 00       	call   5fb <getNumFreePages>
+        for (int i=0; i<size; i++) {
+  d0:	83 c4 10             	add    $0x10,%esp
+        prev_free_pages = getNumFreePages();
+  d3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+        for (int i=0; i<size; i++) {
+  d6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  d9:	09 f0                	or     %esi,%eax
+  db:	0f 84 99 01 00 00    	je     27a <test+0x21a>
+            m1[i] = (char)(65+(i%26));
+  e1:	b9 4f ec c4 4e       	mov    $0x4ec4ec4f,%ecx
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  f0:	89 f8                	mov    %edi,%eax
+  f2:	f7 e1                	mul    %ecx
+  f4:	89 f8                	mov    %edi,%eax
+  f6:	c1 ea 03             	shr    $0x3,%edx
+  f9:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  fc:	29 d0                	sub    %edx,%eax
+  fe:	83 c0 41             	add    $0x41,%eax
+ 101:	88 04 3b             	mov    %al,(%ebx,%edi,1)
+        for (int i=0; i<size; i++) {
+ 104:	83 c7 01             	add    $0x1,%edi
+ 107:	39 f7                	cmp    %esi,%edi
+ 109:	75 e5                	jne    f0 <test+0x90>
+        curr_free_pages = getNumFreePages();
+ 10b:	e8 eb 04 00 00       	call   5fb <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+ 110:	8b 7d cc             	mov    -0x34(%ebp),%edi
+ 113:	39 f8                	cmp    %edi,%eax
+ 115:	0f 83 49 01 00 00    	jae    264 <test+0x204>
+        int x = 0;
+ 11b:	31 c0                	xor    %eax,%eax
+        processing(&x);
+ 11d:	83 ec 0c             	sub    $0xc,%esp
+ 120:	31 f6                	xor    %esi,%esi
+ 122:	31 ff                	xor    %edi,%edi
+        int x = 0;
+ 124:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        processing(&x);
+ 127:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 12a:	50                   	push   %eax
+ 12b:	e8 00 ff ff ff       	call   30 <processing>
+        for(int k=0;k<size;++k){
+ 130:	83 c4 10             	add    $0x10,%esp
+ 133:	eb 1b                	jmp    150 <test+0xf0>
+ 135:	8d 76 00             	lea    0x0(%esi),%esi
+ 138:	83 c6 01             	add    $0x1,%esi
+ 13b:	83 d7 00             	adc    $0x0,%edi
+ 13e:	89 f0                	mov    %esi,%eax
+ 140:	33 45 d0             	xor    -0x30(%ebp),%eax
+ 143:	89 fa                	mov    %edi,%edx
+ 145:	33 55 d4             	xor    -0x2c(%ebp),%edx
+ 148:	09 d0                	or     %edx,%eax
+ 14a:	0f 84 4a 01 00 00    	je     29a <test+0x23a>
+			if(m1[k] != (char)(65+(k%26))) goto failed;
+ 150:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+ 155:	f7 e6                	mul    %esi
+ 157:	89 f0                	mov    %esi,%eax
+ 159:	c1 ea 03             	shr    $0x3,%edx
+ 15c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 15f:	29 d0                	sub    %edx,%eax
+ 161:	83 c0 41             	add    $0x41,%eax
+ 164:	38 04 33             	cmp    %al,(%ebx,%esi,1)
+ 167:	74 cf                	je     138 <test+0xd8>
+    printf(1, "Copy failed: The memory contents of the processes is inconsistent!\n");
+ 169:	50                   	push   %eax
+ 16a:	50                   	push   %eax
+ 16b:	68 34 0b 00 00       	push   $0xb34
+	printf(1, "Failed to fork a process!\n");
+ 170:	6a 01                	push   $0x1
+ 172:	e8 49 05 00 00       	call   6c0 <printf>
+    printf(1, "Lab5 test failed!\n");
+ 177:	5b                   	pop    %ebx
+ 178:	5e                   	pop    %esi
+ 179:	68 13 0a 00 00       	push   $0xa13
+ 17e:	6a 01                	push   $0x1
+ 180:	e8 3b 05 00 00       	call   6c0 <printf>
+	exit();
+ 185:	e8 c9 03 00 00       	call   553 <exit>
+        printf(1, "\n*** Parent ***\n");
+ 18a:	50                   	push   %eax
+ 18b:	50                   	push   %eax
+ 18c:	68 63 0a 00 00       	push   $0xa63
+ 191:	6a 01                	push   $0x1
+ 193:	e8 28 05 00 00       	call   6c0 <printf>
+        prev_free_pages = getNumFreePages();
+ 198:	e8 5e 04 00 00       	call   5fb <getNumFreePages>
+        for (int i=0; i<size; i++) {
+ 19d:	83 c4 10             	add    $0x10,%esp
+        prev_free_pages = getNumFreePages();
+ 1a0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+        for (int i=0; i<size; i++) {
+ 1a3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1a6:	09 f0                	or     %esi,%eax
+ 1a8:	0f 84 02 01 00 00    	je     2b0 <test+0x250>
+ 1ae:	31 c9                	xor    %ecx,%ecx
+            m1[i] = (char)(97+(i%26));
+ 1b0:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+ 1b5:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b8:	89 c8                	mov    %ecx,%eax
+ 1ba:	f7 e7                	mul    %edi
+ 1bc:	89 c8                	mov    %ecx,%eax
+ 1be:	c1 ea 03             	shr    $0x3,%edx
+ 1c1:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 1c4:	29 d0                	sub    %edx,%eax
+ 1c6:	83 c0 61             	add    $0x61,%eax
+ 1c9:	88 04 0b             	mov    %al,(%ebx,%ecx,1)
+        for (int i=0; i<size; i++) {
+ 1cc:	83 c1 01             	add    $0x1,%ecx
+ 1cf:	39 f1                	cmp    %esi,%ecx
+ 1d1:	75 e5                	jne    1b8 <test+0x158>
+        curr_free_pages = getNumFreePages();
+ 1d3:	e8 23 04 00 00       	call   5fb <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+ 1d8:	8b 7d cc             	mov    -0x34(%ebp),%edi
+ 1db:	39 f8                	cmp    %edi,%eax
+ 1dd:	73 6f                	jae    24e <test+0x1ee>
+        processing(&x);
+ 1df:	83 ec 0c             	sub    $0xc,%esp
+ 1e2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+        int x = 0;
+ 1e5:	31 f6                	xor    %esi,%esi
+        processing(&x);
+ 1e7:	31 ff                	xor    %edi,%edi
+        int x = 0;
+ 1e9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+        processing(&x);
+ 1ec:	31 f6                	xor    %esi,%esi
+ 1ee:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 1f1:	50                   	push   %eax
+ 1f2:	e8 39 fe ff ff       	call   30 <processing>
+        for(int k=0;k<size;++k){
+ 1f7:	83 c4 10             	add    $0x10,%esp
+ 1fa:	eb 1c                	jmp    218 <test+0x1b8>
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 c6 01             	add    $0x1,%esi
+ 203:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 206:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 209:	83 d7 00             	adc    $0x0,%edi
+ 20c:	31 fa                	xor    %edi,%edx
+ 20e:	31 f0                	xor    %esi,%eax
+ 210:	09 d0                	or     %edx,%eax
+ 212:	0f 84 bb 00 00 00    	je     2d3 <test+0x273>
+			if(m1[k] != (char)(97+(k%26))) goto failed;
+ 218:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+ 21d:	f7 e6                	mul    %esi
+ 21f:	89 f0                	mov    %esi,%eax
+ 221:	c1 ea 03             	shr    $0x3,%edx
+ 224:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 227:	29 d0                	sub    %edx,%eax
+ 229:	83 c0 61             	add    $0x61,%eax
+ 22c:	38 04 33             	cmp    %al,(%ebx,%esi,1)
+ 22f:	74 cf                	je     200 <test+0x1a0>
+ 231:	e9 33 ff ff ff       	jmp    169 <test+0x109>
+	printf(1, "Exceeded the PHYSTOP!\n");
+ 236:	50                   	push   %eax
+ 237:	50                   	push   %eax
+ 238:	68 fc 09 00 00       	push   $0x9fc
+ 23d:	e9 2e ff ff ff       	jmp    170 <test+0x110>
+	printf(1, "Failed to fork a process!\n");
+ 242:	57                   	push   %edi
+ 243:	57                   	push   %edi
+ 244:	68 38 0a 00 00       	push   $0xa38
+ 249:	e9 22 ff ff ff       	jmp    170 <test+0x110>
+            printf(1, "Lab5 Parent: Free pages should decrease after write\n");
+ 24e:	50                   	push   %eax
+ 24f:	50                   	push   %eax
+ 250:	68 dc 0a 00 00       	push   $0xadc
+ 255:	6a 01                	push   $0x1
+ 257:	e8 64 04 00 00       	call   6c0 <printf>
+            goto failed;
+ 25c:	83 c4 10             	add    $0x10,%esp
+ 25f:	e9 05 ff ff ff       	jmp    169 <test+0x109>
+            printf(1, "Lab5 Child: Free pages should decrease after write\n");
+ 264:	52                   	push   %edx
+ 265:	52                   	push   %edx
+ 266:	68 88 0a 00 00       	push   $0xa88
+ 26b:	6a 01                	push   $0x1
+ 26d:	e8 4e 04 00 00       	call   6c0 <printf>
+            goto failed;
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	e9 ef fe ff ff       	jmp    169 <test+0x109>
+        curr_free_pages = getNumFreePages();
+ 27a:	e8 7c 03 00 00       	call   5fb <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+ 27f:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+ 282:	39 d8                	cmp    %ebx,%eax
+ 284:	73 de                	jae    264 <test+0x204>
+        int x = 0;
+ 286:	31 c0                	xor    %eax,%eax
+        processing(&x);
+ 288:	83 ec 0c             	sub    $0xc,%esp
+        int x = 0;
+ 28b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        processing(&x);
+ 28e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 291:	50                   	push   %eax
+ 292:	e8 99 fd ff ff       	call   30 <processing>
+ 297:	83 c4 10             	add    $0x10,%esp
+        printf(1, "[COW] Lab5 Child test passed!\n");
+ 29a:	50                   	push   %eax
+ 29b:	50                   	push   %eax
+ 29c:	68 bc 0a 00 00       	push   $0xabc
+ 2a1:	6a 01                	push   $0x1
+ 2a3:	e8 18 04 00 00       	call   6c0 <printf>
+ 2a8:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 2ab:	e8 a3 02 00 00       	call   553 <exit>
+        curr_free_pages = getNumFreePages();
+ 2b0:	e8 46 03 00 00       	call   5fb <getNumFreePages>
+        if (curr_free_pages >= prev_free_pages) {
+ 2b5:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+ 2b8:	39 d8                	cmp    %ebx,%eax
+ 2ba:	73 92                	jae    24e <test+0x1ee>
+        processing(&x);
+ 2bc:	83 ec 0c             	sub    $0xc,%esp
+ 2bf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+        int x = 0;
+ 2c2:	31 ff                	xor    %edi,%edi
+ 2c4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+        processing(&x);
+ 2c7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 2ca:	50                   	push   %eax
+ 2cb:	e8 60 fd ff ff       	call   30 <processing>
+ 2d0:	83 c4 10             	add    $0x10,%esp
+        wait();
+ 2d3:	e8 83 02 00 00       	call   55b <wait>
+        processing(&x);
+ 2d8:	83 ec 0c             	sub    $0xc,%esp
+ 2db:	ff 75 cc             	push   -0x34(%ebp)
+ 2de:	e8 4d fd ff ff       	call   30 <processing>
+        printf(1, "done processing %d\n", x);
+ 2e3:	83 c4 0c             	add    $0xc,%esp
+ 2e6:	ff 75 e4             	push   -0x1c(%ebp)
+ 2e9:	68 e8 09 00 00       	push   $0x9e8
+ 2ee:	6a 01                	push   $0x1
+ 2f0:	e8 cb 03 00 00       	call   6c0 <printf>
+        printf(1, "[COW] Lab5 Parent test passed!\n");
+ 2f5:	5a                   	pop    %edx
+ 2f6:	59                   	pop    %ecx
+ 2f7:	68 14 0b 00 00       	push   $0xb14
+ 2fc:	6a 01                	push   $0x1
+ 2fe:	e8 bd 03 00 00       	call   6c0 <printf>
+ 303:	83 c4 10             	add    $0x10,%esp
+ 306:	eb a3                	jmp    2ab <test+0x24b>
+ 308:	66 90                	xchg   %ax,%ax
+ 30a:	66 90                	xchg   %ax,%ax
+ 30c:	66 90                	xchg   %ax,%ax
+ 30e:	66 90                	xchg   %ax,%ax
+
+00000310 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 310:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 311:	31 c0                	xor    %eax,%eax
+{
+ 313:	89 e5                	mov    %esp,%ebp
+ 315:	53                   	push   %ebx
+ 316:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 319:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 320:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 324:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 327:	83 c0 01             	add    $0x1,%eax
+ 32a:	84 d2                	test   %dl,%dl
+ 32c:	75 f2                	jne    320 <strcpy+0x10>
+    ;
+  return os;
+}
+ 32e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 331:	89 c8                	mov    %ecx,%eax
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+ 335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	53                   	push   %ebx
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+ 347:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 34a:	0f b6 02             	movzbl (%edx),%eax
+ 34d:	84 c0                	test   %al,%al
+ 34f:	75 17                	jne    368 <strcmp+0x28>
+ 351:	eb 3a                	jmp    38d <strcmp+0x4d>
+ 353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 357:	90                   	nop
+ 358:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 35c:	83 c2 01             	add    $0x1,%edx
+ 35f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 362:	84 c0                	test   %al,%al
+ 364:	74 1a                	je     380 <strcmp+0x40>
+    p++, q++;
+ 366:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 368:	0f b6 19             	movzbl (%ecx),%ebx
+ 36b:	38 c3                	cmp    %al,%bl
+ 36d:	74 e9                	je     358 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 36f:	29 d8                	sub    %ebx,%eax
+}
+ 371:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 374:	c9                   	leave
+ 375:	c3                   	ret
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 380:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 384:	31 c0                	xor    %eax,%eax
+ 386:	29 d8                	sub    %ebx,%eax
+}
+ 388:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 38b:	c9                   	leave
+ 38c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 38d:	0f b6 19             	movzbl (%ecx),%ebx
+ 390:	31 c0                	xor    %eax,%eax
+ 392:	eb db                	jmp    36f <strcmp+0x2f>
+ 394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3a9:	74 15                	je     3c0 <strlen+0x20>
+ 3ab:	31 c0                	xor    %eax,%eax
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 3b0:	83 c0 01             	add    $0x1,%eax
+ 3b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3b7:	89 c1                	mov    %eax,%ecx
+ 3b9:	75 f5                	jne    3b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3bb:	89 c8                	mov    %ecx,%eax
+ 3bd:	5d                   	pop    %ebp
+ 3be:	c3                   	ret
+ 3bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3c0:	31 c9                	xor    %ecx,%ecx
+}
+ 3c2:	5d                   	pop    %ebp
+ 3c3:	89 c8                	mov    %ecx,%eax
+ 3c5:	c3                   	ret
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3dd:	89 d7                	mov    %edx,%edi
+ 3df:	fc                   	cld
+ 3e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3e5:	89 d0                	mov    %edx,%eax
+ 3e7:	c9                   	leave
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3fa:	0f b6 10             	movzbl (%eax),%edx
+ 3fd:	84 d2                	test   %dl,%dl
+ 3ff:	75 12                	jne    413 <strchr+0x23>
+ 401:	eb 1d                	jmp    420 <strchr+0x30>
+ 403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 407:	90                   	nop
+ 408:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 40c:	83 c0 01             	add    $0x1,%eax
+ 40f:	84 d2                	test   %dl,%dl
+ 411:	74 0d                	je     420 <strchr+0x30>
+    if(*s == c)
+ 413:	38 d1                	cmp    %dl,%cl
+ 415:	75 f1                	jne    408 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 417:	5d                   	pop    %ebp
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 420:	31 c0                	xor    %eax,%eax
+}
+ 422:	5d                   	pop    %ebp
+ 423:	c3                   	ret
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 435:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 438:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 439:	31 db                	xor    %ebx,%ebx
+{
+ 43b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 43e:	eb 27                	jmp    467 <gets+0x37>
+    cc = read(0, &c, 1);
+ 440:	83 ec 04             	sub    $0x4,%esp
+ 443:	6a 01                	push   $0x1
+ 445:	56                   	push   %esi
+ 446:	6a 00                	push   $0x0
+ 448:	e8 1e 01 00 00       	call   56b <read>
+    if(cc < 1)
+ 44d:	83 c4 10             	add    $0x10,%esp
+ 450:	85 c0                	test   %eax,%eax
+ 452:	7e 1d                	jle    471 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 454:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 458:	8b 55 08             	mov    0x8(%ebp),%edx
+ 45b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 45f:	3c 0a                	cmp    $0xa,%al
+ 461:	74 10                	je     473 <gets+0x43>
+ 463:	3c 0d                	cmp    $0xd,%al
+ 465:	74 0c                	je     473 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 467:	89 df                	mov    %ebx,%edi
+ 469:	83 c3 01             	add    $0x1,%ebx
+ 46c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 46f:	7c cf                	jl     440 <gets+0x10>
+ 471:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 473:	8b 45 08             	mov    0x8(%ebp),%eax
+ 476:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 47a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 47d:	5b                   	pop    %ebx
+ 47e:	5e                   	pop    %esi
+ 47f:	5f                   	pop    %edi
+ 480:	5d                   	pop    %ebp
+ 481:	c3                   	ret
+ 482:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	56                   	push   %esi
+ 494:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 495:	83 ec 08             	sub    $0x8,%esp
+ 498:	6a 00                	push   $0x0
+ 49a:	ff 75 08             	push   0x8(%ebp)
+ 49d:	e8 f1 00 00 00       	call   593 <open>
+  if(fd < 0)
+ 4a2:	83 c4 10             	add    $0x10,%esp
+ 4a5:	85 c0                	test   %eax,%eax
+ 4a7:	78 27                	js     4d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4a9:	83 ec 08             	sub    $0x8,%esp
+ 4ac:	ff 75 0c             	push   0xc(%ebp)
+ 4af:	89 c3                	mov    %eax,%ebx
+ 4b1:	50                   	push   %eax
+ 4b2:	e8 f4 00 00 00       	call   5ab <fstat>
+  close(fd);
+ 4b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4bc:	e8 ba 00 00 00       	call   57b <close>
+  return r;
+ 4c1:	83 c4 10             	add    $0x10,%esp
+}
+ 4c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4c7:	89 f0                	mov    %esi,%eax
+ 4c9:	5b                   	pop    %ebx
+ 4ca:	5e                   	pop    %esi
+ 4cb:	5d                   	pop    %ebp
+ 4cc:	c3                   	ret
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4d5:	eb ed                	jmp    4c4 <stat+0x34>
+ 4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	53                   	push   %ebx
+ 4e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4e7:	0f be 02             	movsbl (%edx),%eax
+ 4ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4f5:	77 1e                	ja     515 <atoi+0x35>
+ 4f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 500:	83 c2 01             	add    $0x1,%edx
+ 503:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 506:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 50a:	0f be 02             	movsbl (%edx),%eax
+ 50d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 510:	80 fb 09             	cmp    $0x9,%bl
+ 513:	76 eb                	jbe    500 <atoi+0x20>
+  return n;
+}
+ 515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 518:	89 c8                	mov    %ecx,%eax
+ 51a:	c9                   	leave
+ 51b:	c3                   	ret
+ 51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+ 525:	8b 45 10             	mov    0x10(%ebp),%eax
+ 528:	8b 55 08             	mov    0x8(%ebp),%edx
+ 52b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 52e:	85 c0                	test   %eax,%eax
+ 530:	7e 13                	jle    545 <memmove+0x25>
+ 532:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 534:	89 d7                	mov    %edx,%edi
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 540:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 541:	39 f8                	cmp    %edi,%eax
+ 543:	75 fb                	jne    540 <memmove+0x20>
+  return vdst;
+}
+ 545:	5e                   	pop    %esi
+ 546:	89 d0                	mov    %edx,%eax
+ 548:	5f                   	pop    %edi
+ 549:	5d                   	pop    %ebp
+ 54a:	c3                   	ret
+
+0000054b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 54b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <exit>:
+SYSCALL(exit)
+ 553:	b8 02 00 00 00       	mov    $0x2,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <wait>:
+SYSCALL(wait)
+ 55b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <pipe>:
+SYSCALL(pipe)
+ 563:	b8 04 00 00 00       	mov    $0x4,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <read>:
+SYSCALL(read)
+ 56b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <write>:
+SYSCALL(write)
+ 573:	b8 10 00 00 00       	mov    $0x10,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <close>:
+SYSCALL(close)
+ 57b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <kill>:
+SYSCALL(kill)
+ 583:	b8 06 00 00 00       	mov    $0x6,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <exec>:
+SYSCALL(exec)
+ 58b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <open>:
+SYSCALL(open)
+ 593:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <mknod>:
+SYSCALL(mknod)
+ 59b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <unlink>:
+SYSCALL(unlink)
+ 5a3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <fstat>:
+SYSCALL(fstat)
+ 5ab:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <link>:
+SYSCALL(link)
+ 5b3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <mkdir>:
+SYSCALL(mkdir)
+ 5bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <chdir>:
+SYSCALL(chdir)
+ 5c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <dup>:
+SYSCALL(dup)
+ 5cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <getpid>:
+SYSCALL(getpid)
+ 5d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <sbrk>:
+SYSCALL(sbrk)
+ 5db:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <sleep>:
+SYSCALL(sleep)
+ 5e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <uptime>:
+SYSCALL(uptime)
+ 5eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <getrss>:
+SYSCALL(getrss)
+ 5f3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ 5fb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <getvmstat>:
+SYSCALL(getvmstat)
+ 603:	b8 18 00 00 00       	mov    $0x18,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <vmctl>:
+SYSCALL(vmctl)
+ 60b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <spawn>:
+SYSCALL(spawn)
+ 613:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+ 61b:	66 90                	xchg   %ax,%ax
+ 61d:	66 90                	xchg   %ax,%ax
+ 61f:	90                   	nop
+
+00000620 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 628:	89 d1                	mov    %edx,%ecx
+{
+ 62a:	83 ec 3c             	sub    $0x3c,%esp
+ 62d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 630:	85 d2                	test   %edx,%edx
+ 632:	0f 89 80 00 00 00    	jns    6b8 <printint+0x98>
+ 638:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 63c:	74 7a                	je     6b8 <printint+0x98>
+    x = -xx;
+ 63e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 640:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 645:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 648:	31 f6                	xor    %esi,%esi
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 650:	89 c8                	mov    %ecx,%eax
+ 652:	31 d2                	xor    %edx,%edx
+ 654:	89 f7                	mov    %esi,%edi
+ 656:	f7 f3                	div    %ebx
+ 658:	8d 76 01             	lea    0x1(%esi),%esi
+ 65b:	0f b6 92 d8 0b 00 00 	movzbl 0xbd8(%edx),%edx
+ 662:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 666:	89 ca                	mov    %ecx,%edx
+ 668:	89 c1                	mov    %eax,%ecx
+ 66a:	39 da                	cmp    %ebx,%edx
+ 66c:	73 e2                	jae    650 <printint+0x30>
+  if(neg)
+ 66e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 671:	85 c0                	test   %eax,%eax
+ 673:	74 07                	je     67c <printint+0x5c>
+    buf[i++] = '-';
+ 675:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 67a:	89 f7                	mov    %esi,%edi
+ 67c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 67f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 682:	01 df                	add    %ebx,%edi
+ 684:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 688:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 68b:	83 ec 04             	sub    $0x4,%esp
+ 68e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 691:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 694:	6a 01                	push   $0x1
+ 696:	50                   	push   %eax
+ 697:	56                   	push   %esi
+ 698:	e8 d6 fe ff ff       	call   573 <write>
+  while(--i >= 0)
+ 69d:	89 f8                	mov    %edi,%eax
+ 69f:	83 c4 10             	add    $0x10,%esp
+ 6a2:	83 ef 01             	sub    $0x1,%edi
+ 6a5:	39 d8                	cmp    %ebx,%eax
+ 6a7:	75 df                	jne    688 <printint+0x68>
+}
+ 6a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ac:	5b                   	pop    %ebx
+ 6ad:	5e                   	pop    %esi
+ 6ae:	5f                   	pop    %edi
+ 6af:	5d                   	pop    %ebp
+ 6b0:	c3                   	ret
+ 6b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6b8:	31 c0                	xor    %eax,%eax
+ 6ba:	eb 89                	jmp    645 <printint+0x25>
+ 6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	57                   	push   %edi
+ 6c4:	56                   	push   %esi
+ 6c5:	53                   	push   %ebx
+ 6c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 6d2:	83 c6 01             	add    $0x1,%esi
+ 6d5:	84 db                	test   %bl,%bl
+ 6d7:	74 67                	je     740 <printf+0x80>
+ 6d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6dc:	31 d2                	xor    %edx,%edx
+ 6de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6e1:	eb 34                	jmp    717 <printf+0x57>
+ 6e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6e7:	90                   	nop
+ 6e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6f0:	83 f8 25             	cmp    $0x25,%eax
+ 6f3:	74 18                	je     70d <printf+0x4d>
+  write(fd, &c, 1);
+ 6f5:	83 ec 04             	sub    $0x4,%esp
+ 6f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fe:	6a 01                	push   $0x1
+ 700:	50                   	push   %eax
+ 701:	57                   	push   %edi
+ 702:	e8 6c fe ff ff       	call   573 <write>
+ 707:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 70a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 70d:	0f b6 1e             	movzbl (%esi),%ebx
+ 710:	83 c6 01             	add    $0x1,%esi
+ 713:	84 db                	test   %bl,%bl
+ 715:	74 29                	je     740 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 717:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 71a:	85 d2                	test   %edx,%edx
+ 71c:	74 ca                	je     6e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 71e:	83 fa 25             	cmp    $0x25,%edx
+ 721:	75 ea                	jne    70d <printf+0x4d>
+      if(c == 'd'){
+ 723:	83 f8 25             	cmp    $0x25,%eax
+ 726:	0f 84 24 01 00 00    	je     850 <printf+0x190>
+ 72c:	83 e8 63             	sub    $0x63,%eax
+ 72f:	83 f8 15             	cmp    $0x15,%eax
+ 732:	77 1c                	ja     750 <printf+0x90>
+ 734:	ff 24 85 80 0b 00 00 	jmp    *0xb80(,%eax,4)
+ 73b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 740:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 743:	5b                   	pop    %ebx
+ 744:	5e                   	pop    %esi
+ 745:	5f                   	pop    %edi
+ 746:	5d                   	pop    %ebp
+ 747:	c3                   	ret
+ 748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74f:	90                   	nop
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 756:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 75a:	6a 01                	push   $0x1
+ 75c:	52                   	push   %edx
+ 75d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 760:	57                   	push   %edi
+ 761:	e8 0d fe ff ff       	call   573 <write>
+ 766:	83 c4 0c             	add    $0xc,%esp
+ 769:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 76c:	6a 01                	push   $0x1
+ 76e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 771:	52                   	push   %edx
+ 772:	57                   	push   %edi
+ 773:	e8 fb fd ff ff       	call   573 <write>
+        putc(fd, c);
+ 778:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 77b:	31 d2                	xor    %edx,%edx
+ 77d:	eb 8e                	jmp    70d <printf+0x4d>
+ 77f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 780:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 78b:	8b 13                	mov    (%ebx),%edx
+ 78d:	6a 00                	push   $0x0
+ 78f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 791:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 794:	e8 87 fe ff ff       	call   620 <printint>
+        ap++;
+ 799:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 79c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 79f:	31 d2                	xor    %edx,%edx
+ 7a1:	e9 67 ff ff ff       	jmp    70d <printf+0x4d>
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7b5:	83 c0 04             	add    $0x4,%eax
+ 7b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7bb:	85 db                	test   %ebx,%ebx
+ 7bd:	0f 84 9d 00 00 00    	je     860 <printf+0x1a0>
+        while(*s != 0){
+ 7c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7c8:	84 c0                	test   %al,%al
+ 7ca:	0f 84 3d ff ff ff    	je     70d <printf+0x4d>
+ 7d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7d6:	89 de                	mov    %ebx,%esi
+ 7d8:	89 d3                	mov    %edx,%ebx
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	53                   	push   %ebx
+ 7ec:	57                   	push   %edi
+ 7ed:	e8 81 fd ff ff       	call   573 <write>
+        while(*s != 0){
+ 7f2:	0f b6 06             	movzbl (%esi),%eax
+ 7f5:	83 c4 10             	add    $0x10,%esp
+ 7f8:	84 c0                	test   %al,%al
+ 7fa:	75 e4                	jne    7e0 <printf+0x120>
+      state = 0;
+ 7fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7ff:	31 d2                	xor    %edx,%edx
+ 801:	e9 07 ff ff ff       	jmp    70d <printf+0x4d>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 810:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 81b:	8b 13                	mov    (%ebx),%edx
+ 81d:	6a 01                	push   $0x1
+ 81f:	e9 6b ff ff ff       	jmp    78f <printf+0xcf>
+ 824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 828:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 82b:	83 ec 04             	sub    $0x4,%esp
+ 82e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 831:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 833:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 836:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 839:	6a 01                	push   $0x1
+ 83b:	52                   	push   %edx
+ 83c:	57                   	push   %edi
+ 83d:	e8 31 fd ff ff       	call   573 <write>
+        ap++;
+ 842:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 845:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 848:	31 d2                	xor    %edx,%edx
+ 84a:	e9 be fe ff ff       	jmp    70d <printf+0x4d>
+ 84f:	90                   	nop
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 856:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 859:	6a 01                	push   $0x1
+ 85b:	e9 11 ff ff ff       	jmp    771 <printf+0xb1>
+ 860:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 865:	bb 78 0b 00 00       	mov    $0xb78,%ebx
+ 86a:	e9 61 ff ff ff       	jmp    7d0 <printf+0x110>
+ 86f:	90                   	nop
+
+00000870 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 870:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 871:	a1 b4 0e 00 00       	mov    0xeb4,%eax
+{
+ 876:	89 e5                	mov    %esp,%ebp
+ 878:	57                   	push   %edi
+ 879:	56                   	push   %esi
+ 87a:	53                   	push   %ebx
+ 87b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 87e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 888:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 88a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 88c:	39 ca                	cmp    %ecx,%edx
+ 88e:	73 30                	jae    8c0 <free+0x50>
+ 890:	39 c1                	cmp    %eax,%ecx
+ 892:	72 04                	jb     898 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 894:	39 c2                	cmp    %eax,%edx
+ 896:	72 f0                	jb     888 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 898:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 89b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 89e:	39 f8                	cmp    %edi,%eax
+ 8a0:	74 2e                	je     8d0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8a2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8a5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8a8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8ab:	39 f1                	cmp    %esi,%ecx
+ 8ad:	74 38                	je     8e7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8af:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8b1:	5b                   	pop    %ebx
+  freep = p;
+ 8b2:	89 15 b4 0e 00 00    	mov    %edx,0xeb4
+}
+ 8b8:	5e                   	pop    %esi
+ 8b9:	5f                   	pop    %edi
+ 8ba:	5d                   	pop    %ebp
+ 8bb:	c3                   	ret
+ 8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8c0:	39 c1                	cmp    %eax,%ecx
+ 8c2:	72 d0                	jb     894 <free+0x24>
+ 8c4:	eb c2                	jmp    888 <free+0x18>
+ 8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8d0:	03 70 04             	add    0x4(%eax),%esi
+ 8d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8d6:	8b 02                	mov    (%edx),%eax
+ 8d8:	8b 00                	mov    (%eax),%eax
+ 8da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8e3:	39 f1                	cmp    %esi,%ecx
+ 8e5:	75 c8                	jne    8af <free+0x3f>
+    p->s.size += bp->s.size;
+ 8e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8ea:	89 15 b4 0e 00 00    	mov    %edx,0xeb4
+    p->s.size += bp->s.size;
+ 8f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8f8:	5b                   	pop    %ebx
+ 8f9:	5e                   	pop    %esi
+ 8fa:	5f                   	pop    %edi
+ 8fb:	5d                   	pop    %ebp
+ 8fc:	c3                   	ret
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000900 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 909:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 90c:	8b 15 b4 0e 00 00    	mov    0xeb4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 912:	8d 78 07             	lea    0x7(%eax),%edi
+ 915:	c1 ef 03             	shr    $0x3,%edi
+ 918:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 91b:	85 d2                	test   %edx,%edx
+ 91d:	0f 84 8d 00 00 00    	je     9b0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 923:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 925:	8b 48 04             	mov    0x4(%eax),%ecx
+ 928:	39 f9                	cmp    %edi,%ecx
+ 92a:	73 64                	jae    990 <malloc+0x90>
+  if(nu < 4096)
+ 92c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 931:	39 df                	cmp    %ebx,%edi
+ 933:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 936:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 93d:	eb 0a                	jmp    949 <malloc+0x49>
+ 93f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 940:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 942:	8b 48 04             	mov    0x4(%eax),%ecx
+ 945:	39 f9                	cmp    %edi,%ecx
+ 947:	73 47                	jae    990 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 949:	89 c2                	mov    %eax,%edx
+ 94b:	39 05 b4 0e 00 00    	cmp    %eax,0xeb4
+ 951:	75 ed                	jne    940 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 953:	83 ec 0c             	sub    $0xc,%esp
+ 956:	56                   	push   %esi
+ 957:	e8 7f fc ff ff       	call   5db <sbrk>
+  if(p == (char*)-1)
+ 95c:	83 c4 10             	add    $0x10,%esp
+ 95f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 962:	74 1c                	je     980 <malloc+0x80>
+  hp->s.size = nu;
+ 964:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 967:	83 ec 0c             	sub    $0xc,%esp
+ 96a:	83 c0 08             	add    $0x8,%eax
+ 96d:	50                   	push   %eax
+ 96e:	e8 fd fe ff ff       	call   870 <free>
+  return freep;
+ 973:	8b 15 b4 0e 00 00    	mov    0xeb4,%edx
+      if((p = morecore(nunits)) == 0)
+ 979:	83 c4 10             	add    $0x10,%esp
+ 97c:	85 d2                	test   %edx,%edx
+ 97e:	75 c0                	jne    940 <malloc+0x40>
+        return 0;
+  }
+}
+ 980:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 983:	31 c0                	xor    %eax,%eax
+}
+ 985:	5b                   	pop    %ebx
+ 986:	5e                   	pop    %esi
+ 987:	5f                   	pop    %edi
+ 988:	5d                   	pop    %ebp
+ 989:	c3                   	ret
+ 98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 990:	39 cf                	cmp    %ecx,%edi
+ 992:	74 4c                	je     9e0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 994:	29 f9                	sub    %edi,%ecx
+ 996:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 999:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 99c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 99f:	89 15 b4 0e 00 00    	mov    %edx,0xeb4
+}
+ 9a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9a8:	83 c0 08             	add    $0x8,%eax
+}
+ 9ab:	5b                   	pop    %ebx
+ 9ac:	5e                   	pop    %esi
+ 9ad:	5f                   	pop    %edi
+ 9ae:	5d                   	pop    %ebp
+ 9af:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9b0:	c7 05 b4 0e 00 00 b8 	movl   $0xeb8,0xeb4
+ 9b7:	0e 00 00 
+    base.s.size = 0;
+ 9ba:	b8 b8 0e 00 00       	mov    $0xeb8,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9bf:	c7 05 b8 0e 00 00 b8 	movl   $0xeb8,0xeb8
+ 9c6:	0e 00 00 
+    base.s.size = 0;
+ 9c9:	c7 05 bc 0e 00 00 00 	movl   $0x0,0xebc
+ 9d0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9d3:	e9 54 ff ff ff       	jmp    92c <malloc+0x2c>
+ 9d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9e0:	8b 08                	mov    (%eax),%ecx
+ 9e2:	89 0a                	mov    %ecx,(%edx)
+ 9e4:	eb b9                	jmp    99f <malloc+0x9f>
@@ -0,0 +1,1425 @@
+
+_testcow4:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+    // printf(1, "Memtest starting\n");
+    mem();
+   6:	e8 25 00 00 00       	call   30 <mem>
+   b:	66 90                	xchg   %ax,%ax
+   d:	66 90                	xchg   %ax,%ax
+   f:	90                   	nop
+
+00000010 <print_free_pages>:
+void print_free_pages(){
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	83 ec 08             	sub    $0x8,%esp
+    printf(1, "Free pages : %d\n", getNumFreePages());
+  16:	e8 a0 05 00 00       	call   5bb <getNumFreePages>
+  1b:	83 ec 04             	sub    $0x4,%esp
+  1e:	50                   	push   %eax
+  1f:	68 a8 09 00 00       	push   $0x9a8
+  24:	6a 01                	push   $0x1
+  26:	e8 55 06 00 00       	call   680 <printf>
+}
+  2b:	83 c4 10             	add    $0x10,%esp
+  2e:	c9                   	leave
+  2f:	c3                   	ret
+
+00000030 <mem>:
+{
+  30:	55                   	push   %ebp
+  31:	89 e5                	mov    %esp,%ebp
+  33:	57                   	push   %edi
+    long long size = ((prev_free_pages - 20) * 4096);
+  34:	31 ff                	xor    %edi,%edi
+{
+  36:	56                   	push   %esi
+  37:	53                   	push   %ebx
+  38:	83 ec 1c             	sub    $0x1c,%esp
+    uint prev_free_pages = getNumFreePages();
+  3b:	e8 7b 05 00 00       	call   5bb <getNumFreePages>
+    printf(1,"size : %d\n", size/4096);
+  40:	89 fa                	mov    %edi,%edx
+    long long size = ((prev_free_pages - 20) * 4096);
+  42:	83 e8 14             	sub    $0x14,%eax
+    printf(1,"size : %d\n", size/4096);
+  45:	c1 fa 0c             	sar    $0xc,%edx
+    long long size = ((prev_free_pages - 20) * 4096);
+  48:	c1 e0 0c             	shl    $0xc,%eax
+  4b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  4e:	89 c6                	mov    %eax,%esi
+    printf(1,"size : %d\n", size/4096);
+  50:	0f ac f8 0c          	shrd   $0xc,%edi,%eax
+  54:	52                   	push   %edx
+  55:	50                   	push   %eax
+  56:	68 b9 09 00 00       	push   $0x9b9
+  5b:	6a 01                	push   $0x1
+  5d:	e8 1e 06 00 00       	call   680 <printf>
+    print_free_pages();
+  62:	e8 a9 ff ff ff       	call   10 <print_free_pages>
+    printf(1, "Allocating %d bytes for each process\n", size);
+  67:	57                   	push   %edi
+  68:	56                   	push   %esi
+        outer_malloc[i] = (char) (65 + i % 26);
+  69:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    printf(1, "Allocating %d bytes for each process\n", size);
+  6e:	68 5c 0a 00 00       	push   $0xa5c
+  73:	6a 01                	push   $0x1
+  75:	e8 06 06 00 00       	call   680 <printf>
+    print_free_pages();
+  7a:	83 c4 20             	add    $0x20,%esp
+  7d:	e8 8e ff ff ff       	call   10 <print_free_pages>
+    char* outer_malloc = (char*) malloc(100 * 4096);
+  82:	83 ec 0c             	sub    $0xc,%esp
+  85:	68 00 40 06 00       	push   $0x64000
+  8a:	e8 31 08 00 00       	call   8c0 <malloc>
+  8f:	83 c4 10             	add    $0x10,%esp
+    for(int i = 0; i < 100 * 4096; i++){
+  92:	31 c9                	xor    %ecx,%ecx
+    char* outer_malloc = (char*) malloc(100 * 4096);
+  94:	89 c3                	mov    %eax,%ebx
+    for(int i = 0; i < 100 * 4096; i++){
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+        outer_malloc[i] = (char) (65 + i % 26);
+  a0:	89 c8                	mov    %ecx,%eax
+  a2:	f7 e6                	mul    %esi
+  a4:	89 c8                	mov    %ecx,%eax
+  a6:	c1 ea 03             	shr    $0x3,%edx
+  a9:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  ac:	29 d0                	sub    %edx,%eax
+  ae:	83 c0 41             	add    $0x41,%eax
+  b1:	88 04 0b             	mov    %al,(%ebx,%ecx,1)
+    for(int i = 0; i < 100 * 4096; i++){
+  b4:	83 c1 01             	add    $0x1,%ecx
+  b7:	81 f9 00 40 06 00    	cmp    $0x64000,%ecx
+  bd:	75 e1                	jne    a0 <mem+0x70>
+    print_free_pages();
+  bf:	e8 4c ff ff ff       	call   10 <print_free_pages>
+    pid = fork();
+  c4:	e8 42 04 00 00       	call   50b <fork>
+  c9:	89 c7                	mov    %eax,%edi
+  cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    print_free_pages();
+  ce:	e8 3d ff ff ff       	call   10 <print_free_pages>
+    if(pid > 0) {
+  d3:	85 ff                	test   %edi,%edi
+  d5:	0f 8e 43 01 00 00    	jle    21e <mem+0x1ee>
+            parent_malloc = (char*) malloc(50 * 4096);
+  db:	83 ec 0c             	sub    $0xc,%esp
+                parent_malloc[i] = (char) (65 + i % 26);
+  de:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+            parent_malloc = (char*) malloc(50 * 4096);
+  e3:	68 00 20 03 00       	push   $0x32000
+  e8:	e8 d3 07 00 00       	call   8c0 <malloc>
+  ed:	89 c6                	mov    %eax,%esi
+            print_free_pages();
+  ef:	e8 1c ff ff ff       	call   10 <print_free_pages>
+  f4:	83 c4 10             	add    $0x10,%esp
+            for(int i = 0; i < 50 * 4096; i++){
+  f7:	31 c9                	xor    %ecx,%ecx
+  f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+                parent_malloc[i] = (char) (65 + i % 26);
+ 100:	89 c8                	mov    %ecx,%eax
+ 102:	f7 e7                	mul    %edi
+ 104:	89 c8                	mov    %ecx,%eax
+ 106:	c1 ea 03             	shr    $0x3,%edx
+ 109:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 10c:	29 d0                	sub    %edx,%eax
+ 10e:	83 c0 41             	add    $0x41,%eax
+ 111:	88 04 0e             	mov    %al,(%esi,%ecx,1)
+            for(int i = 0; i < 50 * 4096; i++){
+ 114:	83 c1 01             	add    $0x1,%ecx
+ 117:	81 f9 00 20 03 00    	cmp    $0x32000,%ecx
+ 11d:	75 e1                	jne    100 <mem+0xd0>
+            printf(1,"Parent alloc-ed\n");
+ 11f:	83 ec 08             	sub    $0x8,%esp
+            if (parent_malloc[i] != (char) (65 + i % 26)){
+ 122:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+            printf(1,"Parent alloc-ed\n");
+ 127:	68 c4 09 00 00       	push   $0x9c4
+ 12c:	6a 01                	push   $0x1
+ 12e:	e8 4d 05 00 00       	call   680 <printf>
+ 133:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 13a:	83 c4 10             	add    $0x10,%esp
+            if (parent_malloc[i] != (char) (65 + i % 26)){
+ 13d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+        for(int i = 0; i < 50 * 4096; i++){
+ 140:	31 c9                	xor    %ecx,%ecx
+ 142:	eb 0f                	jmp    153 <mem+0x123>
+ 144:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 148:	83 c1 01             	add    $0x1,%ecx
+ 14b:	81 f9 00 20 03 00    	cmp    $0x32000,%ecx
+ 151:	74 3c                	je     18f <mem+0x15f>
+            if (parent_malloc[i] != (char) (65 + i % 26)){
+ 153:	89 c8                	mov    %ecx,%eax
+ 155:	f7 e7                	mul    %edi
+ 157:	89 c8                	mov    %ecx,%eax
+ 159:	c1 ea 03             	shr    $0x3,%edx
+ 15c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 15f:	29 d0                	sub    %edx,%eax
+ 161:	83 c0 41             	add    $0x41,%eax
+ 164:	38 04 0e             	cmp    %al,(%esi,%ecx,1)
+ 167:	74 df                	je     148 <mem+0x118>
+                printf(1,"parent malloc failed\n");
+ 169:	83 ec 08             	sub    $0x8,%esp
+ 16c:	68 d5 09 00 00       	push   $0x9d5
+ 171:	6a 01                	push   $0x1
+ 173:	e8 08 05 00 00       	call   680 <printf>
+                goto failed;
+ 178:	83 c4 10             	add    $0x10,%esp
+    printf(1, "Casual test case Failed!\n");
+ 17b:	83 ec 08             	sub    $0x8,%esp
+ 17e:	68 2b 0a 00 00       	push   $0xa2b
+ 183:	6a 01                	push   $0x1
+ 185:	e8 f6 04 00 00       	call   680 <printf>
+    exit();
+ 18a:	e8 84 03 00 00       	call   513 <exit>
+        wait();
+ 18f:	e8 87 03 00 00       	call   51b <wait>
+            if (parent_malloc[i] != (char) (65 + i % 26)){
+ 194:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+        for(int i = 0; i < 50 * 4096; i++){
+ 199:	31 c9                	xor    %ecx,%ecx
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+            if (parent_malloc[i] != (char) (65 + i % 26)){
+ 1a0:	89 c8                	mov    %ecx,%eax
+ 1a2:	f7 e3                	mul    %ebx
+ 1a4:	89 c8                	mov    %ecx,%eax
+ 1a6:	c1 ea 03             	shr    $0x3,%edx
+ 1a9:	6b d2 1a             	imul   $0x1a,%edx,%edx
+ 1ac:	29 d0                	sub    %edx,%eax
+ 1ae:	83 c0 41             	add    $0x41,%eax
+ 1b1:	38 04 0e             	cmp    %al,(%esi,%ecx,1)
+ 1b4:	75 c5                	jne    17b <mem+0x14b>
+        for(int i = 0; i < 50 * 4096; i++){
+ 1b6:	83 c1 01             	add    $0x1,%ecx
+ 1b9:	81 f9 00 20 03 00    	cmp    $0x32000,%ecx
+ 1bf:	75 df                	jne    1a0 <mem+0x170>
+        for(int i = 0; i < 100 * 4096; i++){
+ 1c1:	31 c9                	xor    %ecx,%ecx
+            if (outer_malloc[i] != (char) (65 + i % 26)){
+ 1c3:	bb 1a 00 00 00       	mov    $0x1a,%ebx
+ 1c8:	89 c8                	mov    %ecx,%eax
+ 1ca:	99                   	cltd
+ 1cb:	f7 fb                	idiv   %ebx
+ 1cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1d0:	83 c2 41             	add    $0x41,%edx
+ 1d3:	38 14 08             	cmp    %dl,(%eax,%ecx,1)
+ 1d6:	75 a3                	jne    17b <mem+0x14b>
+        for(int i = 0; i < 100 * 4096; i++){
+ 1d8:	83 c1 01             	add    $0x1,%ecx
+ 1db:	81 f9 00 40 06 00    	cmp    $0x64000,%ecx
+ 1e1:	75 e5                	jne    1c8 <mem+0x198>
+        print_free_pages();
+ 1e3:	e8 28 fe ff ff       	call   10 <print_free_pages>
+        printf(1,"x : %d\n", x);
+ 1e8:	50                   	push   %eax
+ 1e9:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ 1ec:	53                   	push   %ebx
+ 1ed:	68 eb 09 00 00       	push   $0x9eb
+ 1f2:	6a 01                	push   $0x1
+ 1f4:	e8 87 04 00 00       	call   680 <printf>
+        pid = fork();
+ 1f9:	e8 0d 03 00 00       	call   50b <fork>
+        if (x < 5){
+ 1fe:	83 c4 10             	add    $0x10,%esp
+ 201:	83 fb 05             	cmp    $0x5,%ebx
+ 204:	0f 84 a6 00 00 00    	je     2b0 <mem+0x280>
+            x++;
+ 20a:	83 c3 01             	add    $0x1,%ebx
+ 20d:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+    if(pid > 0) {
+ 210:	85 c0                	test   %eax,%eax
+ 212:	0f 8f 28 ff ff ff    	jg     140 <mem+0x110>
+ 218:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 21b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    else if(pid < 0){ 
+ 21e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 222:	74 16                	je     23a <mem+0x20a>
+        printf(1, "Fork Failed\n");
+ 224:	53                   	push   %ebx
+ 225:	53                   	push   %ebx
+ 226:	68 f3 09 00 00       	push   $0x9f3
+ 22b:	6a 01                	push   $0x1
+ 22d:	e8 4e 04 00 00       	call   680 <printf>
+ 232:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 235:	e8 d9 02 00 00       	call   513 <exit>
+        sleep(100);
+ 23a:	83 ec 0c             	sub    $0xc,%esp
+ 23d:	6a 64                	push   $0x64
+ 23f:	e8 5f 03 00 00       	call   5a3 <sleep>
+        print_free_pages();
+ 244:	e8 c7 fd ff ff       	call   10 <print_free_pages>
+        char* malloc_child = (char*) malloc(size);
+ 249:	59                   	pop    %ecx
+ 24a:	ff 75 e0             	push   -0x20(%ebp)
+ 24d:	e8 6e 06 00 00       	call   8c0 <malloc>
+ 252:	89 c6                	mov    %eax,%esi
+        print_free_pages();
+ 254:	e8 b7 fd ff ff       	call   10 <print_free_pages>
+        for(int i = 0; i < size; i++){
+ 259:	83 c4 10             	add    $0x10,%esp
+ 25c:	31 c9                	xor    %ecx,%ecx
+ 25e:	eb 13                	jmp    273 <mem+0x243>
+            malloc_child[i] = (char) (65 + i % 26);
+ 260:	89 c8                	mov    %ecx,%eax
+ 262:	bf 1a 00 00 00       	mov    $0x1a,%edi
+ 267:	99                   	cltd
+ 268:	f7 ff                	idiv   %edi
+ 26a:	83 c2 41             	add    $0x41,%edx
+ 26d:	88 14 0e             	mov    %dl,(%esi,%ecx,1)
+        for(int i = 0; i < size; i++){
+ 270:	83 c1 01             	add    $0x1,%ecx
+ 273:	39 4d e0             	cmp    %ecx,-0x20(%ebp)
+ 276:	75 e8                	jne    260 <mem+0x230>
+        printf(1,"Child alloc-ed\n");
+ 278:	52                   	push   %edx
+ 279:	52                   	push   %edx
+ 27a:	68 00 0a 00 00       	push   $0xa00
+ 27f:	6a 01                	push   $0x1
+ 281:	e8 fa 03 00 00       	call   680 <printf>
+            if (outer_malloc[i] != (char) (65 + i % 26)){
+ 286:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+        printf(1,"Child alloc-ed\n");
+ 289:	83 c4 10             	add    $0x10,%esp
+            if (outer_malloc[i] != (char) (65 + i % 26)){
+ 28c:	b9 1a 00 00 00       	mov    $0x1a,%ecx
+ 291:	eb 0b                	jmp    29e <mem+0x26e>
+        for(int i = 0; i < 100 * 4096; i++){
+ 293:	83 c6 01             	add    $0x1,%esi
+ 296:	81 fe 00 40 06 00    	cmp    $0x64000,%esi
+ 29c:	74 97                	je     235 <mem+0x205>
+            if (outer_malloc[i] != (char) (65 + i % 26)){
+ 29e:	89 f0                	mov    %esi,%eax
+ 2a0:	99                   	cltd
+ 2a1:	f7 f9                	idiv   %ecx
+ 2a3:	83 c2 41             	add    $0x41,%edx
+ 2a6:	38 14 33             	cmp    %dl,(%ebx,%esi,1)
+ 2a9:	74 e8                	je     293 <mem+0x263>
+ 2ab:	e9 cb fe ff ff       	jmp    17b <mem+0x14b>
+    if(pid > 0)
+ 2b0:	85 c0                	test   %eax,%eax
+ 2b2:	7e 81                	jle    235 <mem+0x205>
+        printf(1, "Casual test case Passed !\n");
+ 2b4:	50                   	push   %eax
+ 2b5:	50                   	push   %eax
+ 2b6:	68 10 0a 00 00       	push   $0xa10
+ 2bb:	6a 01                	push   $0x1
+ 2bd:	e8 be 03 00 00       	call   680 <printf>
+ 2c2:	83 c4 10             	add    $0x10,%esp
+ 2c5:	e9 6b ff ff ff       	jmp    235 <mem+0x205>
+ 2ca:	66 90                	xchg   %ax,%ax
+ 2cc:	66 90                	xchg   %ax,%ax
+ 2ce:	66 90                	xchg   %ax,%ax
+
+000002d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2d1:	31 c0                	xor    %eax,%eax
+{
+ 2d3:	89 e5                	mov    %esp,%ebp
+ 2d5:	53                   	push   %ebx
+ 2d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2e7:	83 c0 01             	add    $0x1,%eax
+ 2ea:	84 d2                	test   %dl,%dl
+ 2ec:	75 f2                	jne    2e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f1:	89 c8                	mov    %ecx,%eax
+ 2f3:	c9                   	leave
+ 2f4:	c3                   	ret
+ 2f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	8b 55 08             	mov    0x8(%ebp),%edx
+ 307:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 30a:	0f b6 02             	movzbl (%edx),%eax
+ 30d:	84 c0                	test   %al,%al
+ 30f:	75 17                	jne    328 <strcmp+0x28>
+ 311:	eb 3a                	jmp    34d <strcmp+0x4d>
+ 313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 317:	90                   	nop
+ 318:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 31c:	83 c2 01             	add    $0x1,%edx
+ 31f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 322:	84 c0                	test   %al,%al
+ 324:	74 1a                	je     340 <strcmp+0x40>
+    p++, q++;
+ 326:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 328:	0f b6 19             	movzbl (%ecx),%ebx
+ 32b:	38 c3                	cmp    %al,%bl
+ 32d:	74 e9                	je     318 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 32f:	29 d8                	sub    %ebx,%eax
+}
+ 331:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 334:	c9                   	leave
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 340:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 344:	31 c0                	xor    %eax,%eax
+ 346:	29 d8                	sub    %ebx,%eax
+}
+ 348:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 34b:	c9                   	leave
+ 34c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 34d:	0f b6 19             	movzbl (%ecx),%ebx
+ 350:	31 c0                	xor    %eax,%eax
+ 352:	eb db                	jmp    32f <strcmp+0x2f>
+ 354:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 366:	80 3a 00             	cmpb   $0x0,(%edx)
+ 369:	74 15                	je     380 <strlen+0x20>
+ 36b:	31 c0                	xor    %eax,%eax
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+ 370:	83 c0 01             	add    $0x1,%eax
+ 373:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 377:	89 c1                	mov    %eax,%ecx
+ 379:	75 f5                	jne    370 <strlen+0x10>
+    ;
+  return n;
+}
+ 37b:	89 c8                	mov    %ecx,%eax
+ 37d:	5d                   	pop    %ebp
+ 37e:	c3                   	ret
+ 37f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 380:	31 c9                	xor    %ecx,%ecx
+}
+ 382:	5d                   	pop    %ebp
+ 383:	89 c8                	mov    %ecx,%eax
+ 385:	c3                   	ret
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000390 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 397:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 39a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 39d:	89 d7                	mov    %edx,%edi
+ 39f:	fc                   	cld
+ 3a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3a5:	89 d0                	mov    %edx,%eax
+ 3a7:	c9                   	leave
+ 3a8:	c3                   	ret
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ba:	0f b6 10             	movzbl (%eax),%edx
+ 3bd:	84 d2                	test   %dl,%dl
+ 3bf:	75 12                	jne    3d3 <strchr+0x23>
+ 3c1:	eb 1d                	jmp    3e0 <strchr+0x30>
+ 3c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3c7:	90                   	nop
+ 3c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3cc:	83 c0 01             	add    $0x1,%eax
+ 3cf:	84 d2                	test   %dl,%dl
+ 3d1:	74 0d                	je     3e0 <strchr+0x30>
+    if(*s == c)
+ 3d3:	38 d1                	cmp    %dl,%cl
+ 3d5:	75 f1                	jne    3c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3d7:	5d                   	pop    %ebp
+ 3d8:	c3                   	ret
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3e0:	31 c0                	xor    %eax,%eax
+}
+ 3e2:	5d                   	pop    %ebp
+ 3e3:	c3                   	ret
+ 3e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3f9:	31 db                	xor    %ebx,%ebx
+{
+ 3fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3fe:	eb 27                	jmp    427 <gets+0x37>
+    cc = read(0, &c, 1);
+ 400:	83 ec 04             	sub    $0x4,%esp
+ 403:	6a 01                	push   $0x1
+ 405:	56                   	push   %esi
+ 406:	6a 00                	push   $0x0
+ 408:	e8 1e 01 00 00       	call   52b <read>
+    if(cc < 1)
+ 40d:	83 c4 10             	add    $0x10,%esp
+ 410:	85 c0                	test   %eax,%eax
+ 412:	7e 1d                	jle    431 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 414:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 418:	8b 55 08             	mov    0x8(%ebp),%edx
+ 41b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 41f:	3c 0a                	cmp    $0xa,%al
+ 421:	74 10                	je     433 <gets+0x43>
+ 423:	3c 0d                	cmp    $0xd,%al
+ 425:	74 0c                	je     433 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 427:	89 df                	mov    %ebx,%edi
+ 429:	83 c3 01             	add    $0x1,%ebx
+ 42c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 42f:	7c cf                	jl     400 <gets+0x10>
+ 431:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 43a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 43d:	5b                   	pop    %ebx
+ 43e:	5e                   	pop    %esi
+ 43f:	5f                   	pop    %edi
+ 440:	5d                   	pop    %ebp
+ 441:	c3                   	ret
+ 442:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	56                   	push   %esi
+ 454:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 455:	83 ec 08             	sub    $0x8,%esp
+ 458:	6a 00                	push   $0x0
+ 45a:	ff 75 08             	push   0x8(%ebp)
+ 45d:	e8 f1 00 00 00       	call   553 <open>
+  if(fd < 0)
+ 462:	83 c4 10             	add    $0x10,%esp
+ 465:	85 c0                	test   %eax,%eax
+ 467:	78 27                	js     490 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 469:	83 ec 08             	sub    $0x8,%esp
+ 46c:	ff 75 0c             	push   0xc(%ebp)
+ 46f:	89 c3                	mov    %eax,%ebx
+ 471:	50                   	push   %eax
+ 472:	e8 f4 00 00 00       	call   56b <fstat>
+  close(fd);
+ 477:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 47a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 47c:	e8 ba 00 00 00       	call   53b <close>
+  return r;
+ 481:	83 c4 10             	add    $0x10,%esp
+}
+ 484:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 487:	89 f0                	mov    %esi,%eax
+ 489:	5b                   	pop    %ebx
+ 48a:	5e                   	pop    %esi
+ 48b:	5d                   	pop    %ebp
+ 48c:	c3                   	ret
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 490:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 495:	eb ed                	jmp    484 <stat+0x34>
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+
+000004a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	53                   	push   %ebx
+ 4a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4a7:	0f be 02             	movsbl (%edx),%eax
+ 4aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4b5:	77 1e                	ja     4d5 <atoi+0x35>
+ 4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4c0:	83 c2 01             	add    $0x1,%edx
+ 4c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ca:	0f be 02             	movsbl (%edx),%eax
+ 4cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4d0:	80 fb 09             	cmp    $0x9,%bl
+ 4d3:	76 eb                	jbe    4c0 <atoi+0x20>
+  return n;
+}
+ 4d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4d8:	89 c8                	mov    %ecx,%eax
+ 4da:	c9                   	leave
+ 4db:	c3                   	ret
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ee:	85 c0                	test   %eax,%eax
+ 4f0:	7e 13                	jle    505 <memmove+0x25>
+ 4f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4f4:	89 d7                	mov    %edx,%edi
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 500:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 501:	39 f8                	cmp    %edi,%eax
+ 503:	75 fb                	jne    500 <memmove+0x20>
+  return vdst;
+}
+ 505:	5e                   	pop    %esi
+ 506:	89 d0                	mov    %edx,%eax
+ 508:	5f                   	pop    %edi
+ 509:	5d                   	pop    %ebp
+ 50a:	c3                   	ret
+
+0000050b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 50b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <exit>:
+SYSCALL(exit)
+ 513:	b8 02 00 00 00       	mov    $0x2,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <wait>:
+SYSCALL(wait)
+ 51b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <pipe>:
+SYSCALL(pipe)
+ 523:	b8 04 00 00 00       	mov    $0x4,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <read>:
+SYSCALL(read)
+ 52b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <write>:
+SYSCALL(write)
+ 533:	b8 10 00 00 00       	mov    $0x10,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <close>:
+SYSCALL(close)
+ 53b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <kill>:
+SYSCALL(kill)
+ 543:	b8 06 00 00 00       	mov    $0x6,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <exec>:
+SYSCALL(exec)
+ 54b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <open>:
+SYSCALL(open)
+ 553:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <mknod>:
+SYSCALL(mknod)
+ 55b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <unlink>:
+SYSCALL(unlink)
+ 563:	b8 12 00 00 00       	mov    $0x12,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <fstat>:
+SYSCALL(fstat)
+ 56b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <link>:
+SYSCALL(link)
+ 573:	b8 13 00 00 00       	mov    $0x13,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <mkdir>:
+SYSCALL(mkdir)
+ 57b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <chdir>:
+SYSCALL(chdir)
+ 583:	b8 09 00 00 00       	mov    $0x9,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <dup>:
+SYSCALL(dup)
+ 58b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <getpid>:
+SYSCALL(getpid)
+ 593:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <sbrk>:
+SYSCALL(sbrk)
+ 59b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <sleep>:
+SYSCALL(sleep)
+ 5a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <uptime>:
+SYSCALL(uptime)
+ 5ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <getrss>:
+SYSCALL(getrss)
+ 5b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ 5bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <getvmstat>:
+SYSCALL(getvmstat)
+ 5c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <vmctl>:
+SYSCALL(vmctl)
+ 5cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <spawn>:
+SYSCALL(spawn)
+ 5d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+ 5db:	66 90                	xchg   %ax,%ax
+ 5dd:	66 90                	xchg   %ax,%ax
+ 5df:	90                   	nop
+
+000005e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	53                   	push   %ebx
+ 5e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5e8:	89 d1                	mov    %edx,%ecx
+{
+ 5ea:	83 ec 3c             	sub    $0x3c,%esp
+ 5ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5f0:	85 d2                	test   %edx,%edx
+ 5f2:	0f 89 80 00 00 00    	jns    678 <printint+0x98>
+ 5f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5fc:	74 7a                	je     678 <printint+0x98>
+    x = -xx;
+ 5fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 600:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 605:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 608:	31 f6                	xor    %esi,%esi
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 610:	89 c8                	mov    %ecx,%eax
+ 612:	31 d2                	xor    %edx,%edx
+ 614:	89 f7                	mov    %esi,%edi
+ 616:	f7 f3                	div    %ebx
+ 618:	8d 76 01             	lea    0x1(%esi),%esi
+ 61b:	0f b6 92 e4 0a 00 00 	movzbl 0xae4(%edx),%edx
+ 622:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 626:	89 ca                	mov    %ecx,%edx
+ 628:	89 c1                	mov    %eax,%ecx
+ 62a:	39 da                	cmp    %ebx,%edx
+ 62c:	73 e2                	jae    610 <printint+0x30>
+  if(neg)
+ 62e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 631:	85 c0                	test   %eax,%eax
+ 633:	74 07                	je     63c <printint+0x5c>
+    buf[i++] = '-';
+ 635:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 63a:	89 f7                	mov    %esi,%edi
+ 63c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 63f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 642:	01 df                	add    %ebx,%edi
+ 644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 648:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 64b:	83 ec 04             	sub    $0x4,%esp
+ 64e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 651:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 654:	6a 01                	push   $0x1
+ 656:	50                   	push   %eax
+ 657:	56                   	push   %esi
+ 658:	e8 d6 fe ff ff       	call   533 <write>
+  while(--i >= 0)
+ 65d:	89 f8                	mov    %edi,%eax
+ 65f:	83 c4 10             	add    $0x10,%esp
+ 662:	83 ef 01             	sub    $0x1,%edi
+ 665:	39 d8                	cmp    %ebx,%eax
+ 667:	75 df                	jne    648 <printint+0x68>
+}
+ 669:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 66c:	5b                   	pop    %ebx
+ 66d:	5e                   	pop    %esi
+ 66e:	5f                   	pop    %edi
+ 66f:	5d                   	pop    %ebp
+ 670:	c3                   	ret
+ 671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 678:	31 c0                	xor    %eax,%eax
+ 67a:	eb 89                	jmp    605 <printint+0x25>
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	53                   	push   %ebx
+ 686:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 689:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 68c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 68f:	0f b6 1e             	movzbl (%esi),%ebx
+ 692:	83 c6 01             	add    $0x1,%esi
+ 695:	84 db                	test   %bl,%bl
+ 697:	74 67                	je     700 <printf+0x80>
+ 699:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 69c:	31 d2                	xor    %edx,%edx
+ 69e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6a1:	eb 34                	jmp    6d7 <printf+0x57>
+ 6a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6a7:	90                   	nop
+ 6a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6b0:	83 f8 25             	cmp    $0x25,%eax
+ 6b3:	74 18                	je     6cd <printf+0x4d>
+  write(fd, &c, 1);
+ 6b5:	83 ec 04             	sub    $0x4,%esp
+ 6b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6be:	6a 01                	push   $0x1
+ 6c0:	50                   	push   %eax
+ 6c1:	57                   	push   %edi
+ 6c2:	e8 6c fe ff ff       	call   533 <write>
+ 6c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 6d0:	83 c6 01             	add    $0x1,%esi
+ 6d3:	84 db                	test   %bl,%bl
+ 6d5:	74 29                	je     700 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6da:	85 d2                	test   %edx,%edx
+ 6dc:	74 ca                	je     6a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6de:	83 fa 25             	cmp    $0x25,%edx
+ 6e1:	75 ea                	jne    6cd <printf+0x4d>
+      if(c == 'd'){
+ 6e3:	83 f8 25             	cmp    $0x25,%eax
+ 6e6:	0f 84 24 01 00 00    	je     810 <printf+0x190>
+ 6ec:	83 e8 63             	sub    $0x63,%eax
+ 6ef:	83 f8 15             	cmp    $0x15,%eax
+ 6f2:	77 1c                	ja     710 <printf+0x90>
+ 6f4:	ff 24 85 8c 0a 00 00 	jmp    *0xa8c(,%eax,4)
+ 6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 700:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 703:	5b                   	pop    %ebx
+ 704:	5e                   	pop    %esi
+ 705:	5f                   	pop    %edi
+ 706:	5d                   	pop    %ebp
+ 707:	c3                   	ret
+ 708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70f:	90                   	nop
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 716:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 71a:	6a 01                	push   $0x1
+ 71c:	52                   	push   %edx
+ 71d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 720:	57                   	push   %edi
+ 721:	e8 0d fe ff ff       	call   533 <write>
+ 726:	83 c4 0c             	add    $0xc,%esp
+ 729:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 72c:	6a 01                	push   $0x1
+ 72e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 731:	52                   	push   %edx
+ 732:	57                   	push   %edi
+ 733:	e8 fb fd ff ff       	call   533 <write>
+        putc(fd, c);
+ 738:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 73b:	31 d2                	xor    %edx,%edx
+ 73d:	eb 8e                	jmp    6cd <printf+0x4d>
+ 73f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 00                	push   $0x0
+ 74f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 751:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 754:	e8 87 fe ff ff       	call   5e0 <printint>
+        ap++;
+ 759:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 75c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 75f:	31 d2                	xor    %edx,%edx
+ 761:	e9 67 ff ff ff       	jmp    6cd <printf+0x4d>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 770:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 773:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 775:	83 c0 04             	add    $0x4,%eax
+ 778:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 77b:	85 db                	test   %ebx,%ebx
+ 77d:	0f 84 9d 00 00 00    	je     820 <printf+0x1a0>
+        while(*s != 0){
+ 783:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 786:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 788:	84 c0                	test   %al,%al
+ 78a:	0f 84 3d ff ff ff    	je     6cd <printf+0x4d>
+ 790:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 793:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 796:	89 de                	mov    %ebx,%esi
+ 798:	89 d3                	mov    %edx,%ebx
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7a9:	6a 01                	push   $0x1
+ 7ab:	53                   	push   %ebx
+ 7ac:	57                   	push   %edi
+ 7ad:	e8 81 fd ff ff       	call   533 <write>
+        while(*s != 0){
+ 7b2:	0f b6 06             	movzbl (%esi),%eax
+ 7b5:	83 c4 10             	add    $0x10,%esp
+ 7b8:	84 c0                	test   %al,%al
+ 7ba:	75 e4                	jne    7a0 <printf+0x120>
+      state = 0;
+ 7bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7bf:	31 d2                	xor    %edx,%edx
+ 7c1:	e9 07 ff ff ff       	jmp    6cd <printf+0x4d>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7db:	8b 13                	mov    (%ebx),%edx
+ 7dd:	6a 01                	push   $0x1
+ 7df:	e9 6b ff ff ff       	jmp    74f <printf+0xcf>
+ 7e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7eb:	83 ec 04             	sub    $0x4,%esp
+ 7ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	52                   	push   %edx
+ 7fc:	57                   	push   %edi
+ 7fd:	e8 31 fd ff ff       	call   533 <write>
+        ap++;
+ 802:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 805:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 808:	31 d2                	xor    %edx,%edx
+ 80a:	e9 be fe ff ff       	jmp    6cd <printf+0x4d>
+ 80f:	90                   	nop
+  write(fd, &c, 1);
+ 810:	83 ec 04             	sub    $0x4,%esp
+ 813:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 816:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 819:	6a 01                	push   $0x1
+ 81b:	e9 11 ff ff ff       	jmp    731 <printf+0xb1>
+ 820:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 825:	bb 82 0a 00 00       	mov    $0xa82,%ebx
+ 82a:	e9 61 ff ff ff       	jmp    790 <printf+0x110>
+ 82f:	90                   	nop
+
+00000830 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 830:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 831:	a1 00 2e 00 00       	mov    0x2e00,%eax
+{
+ 836:	89 e5                	mov    %esp,%ebp
+ 838:	57                   	push   %edi
+ 839:	56                   	push   %esi
+ 83a:	53                   	push   %ebx
+ 83b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 83e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 848:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 84a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 84c:	39 ca                	cmp    %ecx,%edx
+ 84e:	73 30                	jae    880 <free+0x50>
+ 850:	39 c1                	cmp    %eax,%ecx
+ 852:	72 04                	jb     858 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 854:	39 c2                	cmp    %eax,%edx
+ 856:	72 f0                	jb     848 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 858:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 85b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 85e:	39 f8                	cmp    %edi,%eax
+ 860:	74 2e                	je     890 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 862:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 865:	8b 42 04             	mov    0x4(%edx),%eax
+ 868:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 86b:	39 f1                	cmp    %esi,%ecx
+ 86d:	74 38                	je     8a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 86f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 871:	5b                   	pop    %ebx
+  freep = p;
+ 872:	89 15 00 2e 00 00    	mov    %edx,0x2e00
+}
+ 878:	5e                   	pop    %esi
+ 879:	5f                   	pop    %edi
+ 87a:	5d                   	pop    %ebp
+ 87b:	c3                   	ret
+ 87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 880:	39 c1                	cmp    %eax,%ecx
+ 882:	72 d0                	jb     854 <free+0x24>
+ 884:	eb c2                	jmp    848 <free+0x18>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 890:	03 70 04             	add    0x4(%eax),%esi
+ 893:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 896:	8b 02                	mov    (%edx),%eax
+ 898:	8b 00                	mov    (%eax),%eax
+ 89a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 89d:	8b 42 04             	mov    0x4(%edx),%eax
+ 8a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8a3:	39 f1                	cmp    %esi,%ecx
+ 8a5:	75 c8                	jne    86f <free+0x3f>
+    p->s.size += bp->s.size;
+ 8a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8aa:	89 15 00 2e 00 00    	mov    %edx,0x2e00
+    p->s.size += bp->s.size;
+ 8b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8b6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8b8:	5b                   	pop    %ebx
+ 8b9:	5e                   	pop    %esi
+ 8ba:	5f                   	pop    %edi
+ 8bb:	5d                   	pop    %ebp
+ 8bc:	c3                   	ret
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8cc:	8b 15 00 2e 00 00    	mov    0x2e00,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8d2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8d5:	c1 ef 03             	shr    $0x3,%edi
+ 8d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8db:	85 d2                	test   %edx,%edx
+ 8dd:	0f 84 8d 00 00 00    	je     970 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8e5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8e8:	39 f9                	cmp    %edi,%ecx
+ 8ea:	73 64                	jae    950 <malloc+0x90>
+  if(nu < 4096)
+ 8ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8f1:	39 df                	cmp    %ebx,%edi
+ 8f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8fd:	eb 0a                	jmp    909 <malloc+0x49>
+ 8ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 900:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 902:	8b 48 04             	mov    0x4(%eax),%ecx
+ 905:	39 f9                	cmp    %edi,%ecx
+ 907:	73 47                	jae    950 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 909:	89 c2                	mov    %eax,%edx
+ 90b:	39 05 00 2e 00 00    	cmp    %eax,0x2e00
+ 911:	75 ed                	jne    900 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	56                   	push   %esi
+ 917:	e8 7f fc ff ff       	call   59b <sbrk>
+  if(p == (char*)-1)
+ 91c:	83 c4 10             	add    $0x10,%esp
+ 91f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 922:	74 1c                	je     940 <malloc+0x80>
+  hp->s.size = nu;
+ 924:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 927:	83 ec 0c             	sub    $0xc,%esp
+ 92a:	83 c0 08             	add    $0x8,%eax
+ 92d:	50                   	push   %eax
+ 92e:	e8 fd fe ff ff       	call   830 <free>
+  return freep;
+ 933:	8b 15 00 2e 00 00    	mov    0x2e00,%edx
+      if((p = morecore(nunits)) == 0)
+ 939:	83 c4 10             	add    $0x10,%esp
+ 93c:	85 d2                	test   %edx,%edx
+ 93e:	75 c0                	jne    900 <malloc+0x40>
+        return 0;
+  }
+}
+ 940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 943:	31 c0                	xor    %eax,%eax
+}
+ 945:	5b                   	pop    %ebx
+ 946:	5e                   	pop    %esi
+ 947:	5f                   	pop    %edi
+ 948:	5d                   	pop    %ebp
+ 949:	c3                   	ret
+ 94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 950:	39 cf                	cmp    %ecx,%edi
+ 952:	74 4c                	je     9a0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 954:	29 f9                	sub    %edi,%ecx
+ 956:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 959:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 95c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 95f:	89 15 00 2e 00 00    	mov    %edx,0x2e00
+}
+ 965:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 968:	83 c0 08             	add    $0x8,%eax
+}
+ 96b:	5b                   	pop    %ebx
+ 96c:	5e                   	pop    %esi
+ 96d:	5f                   	pop    %edi
+ 96e:	5d                   	pop    %ebp
+ 96f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 970:	c7 05 00 2e 00 00 04 	movl   $0x2e04,0x2e00
+ 977:	2e 00 00 
+    base.s.size = 0;
+ 97a:	b8 04 2e 00 00       	mov    $0x2e04,%eax
+    base.s.ptr = freep = prevp = &base;
+ 97f:	c7 05 04 2e 00 00 04 	movl   $0x2e04,0x2e04
+ 986:	2e 00 00 
+    base.s.size = 0;
+ 989:	c7 05 08 2e 00 00 00 	movl   $0x0,0x2e08
+ 990:	00 00 00 
+    if(p->s.size >= nunits){
+ 993:	e9 54 ff ff ff       	jmp    8ec <malloc+0x2c>
+ 998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9a0:	8b 08                	mov    (%eax),%ecx
+ 9a2:	89 0a                	mov    %ecx,(%edx)
+ 9a4:	eb b9                	jmp    95f <malloc+0x9f>
@@ -71,10 +71,26 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_TLBFLUSH:
+    tlb_shootdown_intr();
+    lapiceoi();
+    break;
   case T_PGFLT:
     //Call the page fault handler
-    pagefault_handler();
-    lapiceoi();
+    if(pagefault_handler() == 0){
+      lapiceoi();
+      break;
+    }
+    if(myproc() == 0 || (tf->cs&3) == 0){
+      cprintf("page fault from cpu %d eip %x (cr2=0x%x)\n",
+              cpuid(), tf->eip, rcr2());
+      panic("trap");
+    }
+    cprintf("pid %d %s: page fault err %d on cpu %d "
+            "eip 0x%x addr 0x%x--kill proc\n",
+            myproc()->pid, myproc()->name, tf->err, cpuid(), tf->eip,
+            rcr2());
+    myproc()->killed = 1;
     break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
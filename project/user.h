@@ -1,5 +1,7 @@
 struct stat;
 struct rtcdate;
+struct vmstat;
+struct spawn_action;
 
 // system calls
 int fork(void);
@@ -25,6 +27,9 @@ int sleep(int);
 int uptime(void);
 int getrss(void);
 int getNumFreePages(void);
+int getvmstat(struct vmstat*);
+int vmctl(int, int);
+int spawn(char*, char**, struct spawn_action*, int);
 
 // ulib.c
 int stat(const char*, struct stat*);
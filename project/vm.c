@@ -6,9 +6,215 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "spinlock.h"
+#include "traps.h"
+#include "vmstat.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
+char *zeropage; // shared, read-only backing for untouched heap pages
+
+// Page fault counters, reported by getvmstat.
+static struct {
+  uint cow;    // writes that broke COW sharing after fork
+  uint zero;   // first writes to heap pages backed by the zero page
+  uint lazy;   // first touches of lazily grown heap pages
+  uint file;   // program pages read in on first touch
+} faultstat;
+
+// TLB invalidation. After changing one PTE only that page's entry needs
+// to go; reloading %cr3 throws away every user translation. A range is
+// invalidated page by page up to TLB_FULL_THRESH pages, and with a full
+// flush beyond that. All of these act on this CPU only, and only when
+// pgdir is the page table it has loaded.
+#define TLB_FULL_THRESH 32
+
+static struct {
+  uint page;     // single-page invalidations
+  uint range;    // ranges invalidated page by page
+  uint full;     // %cr3 reloads
+  uint skipped;  // pgdir was not loaded, nothing to do
+} tlbstat;
+
+void
+tlb_flush_page(pde_t *pgdir, uint va)
+{
+  if(rcr3() != V2P(pgdir)){
+    atomic_inc(&tlbstat.skipped);
+    return;
+  }
+  invlpg((void*)va);
+  atomic_inc(&tlbstat.page);
+}
+
+// Invalidate the pages in [start, end).
+void
+tlb_flush_range(pde_t *pgdir, uint start, uint end)
+{
+  uint a;
+
+  if(rcr3() != V2P(pgdir)){
+    atomic_inc(&tlbstat.skipped);
+    return;
+  }
+  start = PGROUNDDOWN(start);
+  if(end <= start)
+    return;
+  if((end - start) / PGSIZE > TLB_FULL_THRESH){
+    lcr3(V2P(pgdir));
+    atomic_inc(&tlbstat.full);
+    return;
+  }
+  for(a = start; a < end; a += PGSIZE)
+    invlpg((void*)a);
+  atomic_inc(&tlbstat.range);
+}
+
+void
+tlb_flush_all(pde_t *pgdir)
+{
+  if(rcr3() != V2P(pgdir)){
+    atomic_inc(&tlbstat.skipped);
+    return;
+  }
+  lcr3(V2P(pgdir));
+  atomic_inc(&tlbstat.full);
+}
+
+// Cross-CPU shootdown. Each CPU has a queue of addresses that others
+// want dropped from its TLB. A sender queues addresses on every CPU
+// whose loaded page table translates them through the PTE it changed,
+// interrupts just those CPUs, and waits for them to drain their queues.
+// A queue that overflows turns into a full flush.
+#define TLBQ_SIZE 16
+
+static struct tlbq {
+  struct spinlock lock;
+  int n;
+  int full;             // overflowed: flush everything
+  uint va[TLBQ_SIZE];
+  uint queued;          // tickets handed out to senders
+  volatile uint done;   // tickets up to here have been flushed
+} tlbq[NCPU];
+
+static struct {
+  uint ipi;      // shootdown IPIs sent
+  uint remote;   // addresses invalidated on behalf of another CPU
+} shootstat;
+
+void
+tlbqinit(void)
+{
+  for(int i = 0; i < NCPU; i++)
+    initlock(&tlbq[i].lock, "tlbq");
+}
+
+// Flush what other CPUs have queued for this one. Interrupts are off.
+static void
+tlbq_drain(struct tlbq *q)
+{
+  acquire(&q->lock);
+  if(q->full)
+    lcr3(rcr3());
+  else
+    for(int i = 0; i < q->n; i++)
+      invlpg((void*)q->va[i]);
+  __sync_fetch_and_add(&shootstat.remote, q->n);
+  q->n = 0;
+  q->full = 0;
+  q->done = q->queued;
+  release(&q->lock);
+}
+
+// The T_TLBFLUSH handler.
+void
+tlb_shootdown_intr(void)
+{
+  tlbq_drain(&tlbq[cpuid()]);
+}
+
+// Does the page table pgdir translate va through the PTE at pte?
+// Only compares addresses, so pgdir may be changing underneath us.
+static int
+pgdir_uses(pde_t *pgdir, uint va, pte_t *pte)
+{
+  pde_t pde;
+
+  if(pgdir == 0 || va >= KERNBASE)
+    return 0;
+  pde = pgdir[PDX(va)];
+  return (pde & PTE_P) && &((pte_t*)P2V(PTE_ADDR(pde)))[PTX(va)] == pte;
+}
+
+// pte, which may belong to any process, has just been changed. Drop its
+// translation here if it is in use, and queue it on every other CPU that
+// may hold it. Returns a mask of those CPUs for tlb_shootdown_sync().
+uint
+tlb_shootdown_pte(pte_t *pte)
+{
+  struct tlbq *q;
+  uint va, mask;
+  int i, me;
+
+  va = pte2va(pte);
+  mask = 0;
+  // The PTE store must be visible before we look at which page tables
+  // are loaded; switchuvm() stores cpu->pgdir before loading %cr3.
+  __sync_synchronize();
+  pushcli();
+  me = cpuid();
+  for(i = 0; i < ncpu; i++){
+    if(!pgdir_uses(cpus[i].pgdir, va, pte))
+      continue;
+    if(i == me){
+      invlpg((void*)va);
+      atomic_inc(&tlbstat.page);
+      continue;
+    }
+    q = &tlbq[i];
+    acquire(&q->lock);
+    if(q->n < TLBQ_SIZE)
+      q->va[q->n++] = va;
+    else
+      q->full = 1;
+    q->queued++;
+    release(&q->lock);
+    mask |= 1 << i;
+  }
+  popcli();
+  return mask;
+}
+
+// Interrupt the CPUs in mask and wait until each has flushed what was
+// queued for it. Keep draining our own queue meanwhile, in case one of
+// them is waiting on us with interrupts off.
+void
+tlb_shootdown_sync(uint mask)
+{
+  uint ticket[NCPU];
+  int i;
+
+  if(mask == 0)
+    return;
+  pushcli();
+  for(i = 0; i < ncpu; i++){
+    if(!(mask & (1 << i)))
+      continue;
+    acquire(&tlbq[i].lock);
+    ticket[i] = tlbq[i].queued;
+    release(&tlbq[i].lock);
+    lapicipi(cpus[i].apicid, T_TLBFLUSH);
+    atomic_inc(&shootstat.ipi);
+  }
+  for(i = 0; i < ncpu; i++){
+    if(!(mask & (1 << i)))
+      continue;
+    while((int)(tlbq[i].done - ticket[i]) < 0)
+      if(tlbq[cpuid()].done != tlbq[cpuid()].queued)
+        tlbq_drain(&tlbq[cpuid()]);
+  }
+  popcli();
+}
 
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
@@ -29,6 +235,8 @@ seginit(void)
   lgdt(c->gdt, sizeof(c->gdt));
 }
 
+static int pgtab_unshare(pde_t*, uint);
+
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
 // create any required page table pages.
@@ -40,20 +248,142 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
 
   pde = &pgdir[PDX(va)];
   if(*pde & PTE_P){
+    // A table shared after fork must be split before anything in it
+    // can be changed.
+    if(alloc && !(*pde & PTE_W) && (uint)va < KERNBASE &&
+       pgtab_unshare(pgdir, (uint)va) < 0)
+      return 0;
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+    // Comes zeroed, so all those PTE_P bits are clear.
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
       return 0;
-    // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
     *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+    pgtab_setpdx((char*)pgtab, PDX(va));
   }
   return &pgtab[PTX(va)];
 }
 
+// Free a page-table page that nobody maps any more, with the pages
+// it maps.
+static void
+freepgtab(pte_t *pgtab)
+{
+  uint pa;
+  int i, n;
+
+  for(i = 0; i < NPTENTRIES; i++){
+    if(pgtab[i] == 0)
+      continue;
+    if(!(pgtab[i] & PTE_P) && swap_drop(&pgtab[i]) == 0)
+      continue;
+    pa = PTE_ADDR(pgtab[i]);
+    if(iszeropage(pa))
+      continue;
+    if((n = rmap_set(pa, &pgtab[i], 0)) < 0)
+      i--;  // swapped out meanwhile: drop the swap entry instead
+    else if(n == 0)
+      kfree(P2V(pa));
+  }
+  kfree((char*)pgtab);
+}
+
+// Fork shares the parent's page-table pages with the child rather than
+// copying them, and maps them read-only in both page directories: a user
+// PDE that is present but not writable means its table may be shared.
+// The first write anywhere in the table's 4MB region faults, and the
+// writer gets a private copy of the table here. The pages the two copies
+// map become COW-shared like after an ordinary fork.
+static int
+pgtab_unshare(pde_t *pgdir, uint va)
+{
+  pde_t *pde;
+  pte_t *old, *new;
+  uint pa, region;
+  int i, nres;
+
+  pde = &pgdir[PDX(va)];
+  old = (pte_t*)P2V(PTE_ADDR(*pde));
+  region = PGADDR(PDX(va), 0, 0);
+  if(pgtab_nref((char*)old) > 1){
+    // Set aside an rmap node for every entry that may be copied.
+    for(i = nres = 0; i < NPTENTRIES; i++)
+      if(old[i] != 0)
+        nres++;
+    if(rmap_reserve(nres) < 0)
+      return -1;
+    if((new = (pte_t*)kalloc_zeroed()) == 0){
+      rmap_unreserve(nres);
+      return -1;
+    }
+    pgtab_setpdx((char*)new, PDX(va));
+    for(i = 0; i < NPTENTRIES; i++){
+      if(old[i] == 0)
+        continue;
+      // A swapped-out page stays out; new becomes another mapper of its
+      // slot. Only if the slot is full is it read back so both tables can
+      // map it. Reclaim meanwhile goes through the rmap, so it keeps the
+      // entries already copied into new in step with old; rmap_dup()
+      // copies an entry and adds it there in one step.
+      if(!(old[i] & PTE_P) && swap_dup(&old[i], &new[i]) == 0)
+        continue;
+      if(!(old[i] & PTE_P)){
+        swap_in(&old[i]);
+        i--;  // look at it again: it may be gone or out again already
+        continue;
+      }
+      pa = PTE_ADDR(old[i]);
+      if(iszeropage(pa)){
+        old[i] &= ~PTE_W;
+        new[i] = old[i];
+      } else if(rmap_dup(pa, &old[i], &new[i]) < 0)
+        i--;  // swapped out meanwhile
+      else
+        nres--;
+    }
+    rmap_unreserve(nres);
+    *pde = V2P(new) | PTE_P | PTE_W | PTE_U;
+    if(pgtab_unref((char*)old) == 0)
+      freepgtab(old);  // the other sharers let go while we copied
+  } else
+    *pde |= PTE_W;  // everyone else has let go of it already
+  tlb_flush_range(pgdir, region, region + PGSIZE*NPTENTRIES);
+  return 0;
+}
+
+// deallocuvm() is about to clear the PTEs from va up in a table that
+// pgdir may share. If that is the whole table, just drop pgdir's
+// reference, set *resident to the number of pages it mapped that
+// counted towards rss, and return 1. Otherwise make the table private
+// to pgdir and return 0.
+static int
+pgtab_release(pde_t *pgdir, uint va, int *resident)
+{
+  pde_t *pde = &pgdir[PDX(va)];
+  pte_t *pgtab;
+  int i;
+
+  if(va == PGADDR(PDX(va), 0, 0)){
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+    *resident = 0;
+    for(i = 0; i < NPTENTRIES; i++)
+      if((pgtab[i] & PTE_P) && !iszeropage(PTE_ADDR(pgtab[i])))
+        *resident += 1;
+    if(pgtab_unref((char*)pgtab) > 0){
+      *pde = 0;
+      return 1;
+    }
+    *pde |= PTE_W;
+    return 0;
+  }
+  if(pgtab_unshare(pgdir, va) < 0)
+    panic("deallocuvm: unshare");
+  return 0;
+}
+
 // Create PTEs for virtual addresses starting at va that refer to
 // physical addresses starting at pa. va and size might not
 // be page-aligned
@@ -74,8 +404,10 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm, int update_count)
     if(*pte & PTE_P)
       panic("remap");
     *pte = pa | perm | PTE_P;
-    if(update_count)
-      update_ref_count(pa, 1, pte);
+    if(update_count && update_ref_count(pa, 1, pte) < 0){
+      *pte = 0;
+      return -1;
+    }
     if(a == last)
       break;
     a += PGSIZE;
@@ -127,9 +459,8 @@ setupkvm(void)
   pde_t *pgdir;
   struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
   if (P2V(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
@@ -148,6 +479,17 @@ kvmalloc(void)
 {
   kpgdir = setupkvm();
   switchkvm();
+  if((zeropage = kalloc()) == 0)
+    panic("kvmalloc: zeropage");
+  memset(zeropage, 0, PGSIZE);
+}
+
+// Is pa the shared zero page? It is mapped read-only into any number of
+// processes but never refcounted, put in the rmap or swapped out.
+int
+iszeropage(uint pa)
+{
+  return pa == V2P(zeropage);
 }
 
 // Switch h/w page table register to the kernel-only page table,
@@ -179,6 +521,7 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
+  mycpu()->pgdir = p->pgdir;  // before the load; see tlb_shootdown_pte()
   lcr3(V2P(p->pgdir));  // switch to process's address space
   popcli();
 }
@@ -192,9 +535,8 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
+  mem = kalloc_zeroed();
   // update_ref_count(V2P(mem), 1); // increment the reference count of the physical page -> Not sure why this is needed
-  memset(mem, 0, PGSIZE);
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U,1);
   memmove(mem, init, sz);
 }
@@ -227,6 +569,14 @@ loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
 int
 allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+{
+  return allocuvm_p(pgdir, oldsz, newsz, myproc());
+}
+
+// Like allocuvm, but charge the new pages to p, which need not be
+// running yet (spawn() builds the child's page table itself).
+int
+allocuvm_p(pde_t *pgdir, uint oldsz, uint newsz, struct proc *p)
 {
   char *mem;
   uint a;
@@ -238,20 +588,43 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
-      deallocuvm(pgdir, newsz, oldsz);
+      deallocuvm_p(pgdir, newsz, oldsz, p);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U,1) < 0){
       cprintf("allocuvm out of memory (2)\n");
-      deallocuvm(pgdir, newsz, oldsz);
+      deallocuvm_p(pgdir, newsz, oldsz, p);
       kfree(mem);
       return 0;
     }
-    myproc() -> rss += PGSIZE;
+    rss_add(p, PGSIZE);
+  }
+  return newsz;
+}
+
+// Grow process from oldsz to newsz like allocuvm, but map every new page
+// read-only to the shared zero page. A real page is only allocated and
+// zeroed when the process first writes to it (see pagefault_handler).
+int
+allocuvm_zero(pde_t *pgdir, uint oldsz, uint newsz)
+{
+  uint a;
+
+  if(newsz >= KERNBASE)
+    return 0;
+  if(newsz < oldsz)
+    return oldsz;
+
+  a = PGROUNDUP(oldsz);
+  for(; a < newsz; a += PGSIZE){
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(zeropage), PTE_U, 0) < 0){
+      cprintf("allocuvm_zero out of memory\n");
+      deallocuvm(pgdir, newsz, oldsz);
+      return 0;
+    }
   }
   return newsz;
 }
@@ -265,6 +638,7 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
   pte_t *pte;
   uint a, pa;
+  int n;
 
   if(newsz >= oldsz)
     return oldsz;
@@ -272,24 +646,34 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte && !(pgdir[PDX(a)] & PTE_W)){
+      // A table shared after fork: drop it whole or make it private.
+      if(pgtab_release(pgdir, a, &n)){
+        rss_add(myproc(), -n * PGSIZE);
+        a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+        continue;
+      }
+      pte = walkpgdir(pgdir, (char*)a, 0);
+    }
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if(*pte != 0 && !(*pte & PTE_P) && swap_drop(pte) == 0)
+      continue;  // was swapped out: our claim on the slot is given up
     else if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
-      char *v = P2V(pa);
-      update_ref_count(pa, -1, pte);
-      myproc()->rss-=PGSIZE;
-      if(get_count_ref(pa)==0)
-        kfree(v);
-      *pte = 0;
-    }
-    else if((*pte & PTE_SWAP) !=0){
-      // get the swap slot
-      // find out the refcount 
-      // decrease the refcount
-      // if refcount is zero then kfree
+      if(iszeropage(pa)){
+        *pte = 0;
+        continue;
+      }
+      if((n = rmap_set(pa, pte, 0)) < 0){
+        a -= PGSIZE;  // swapped out meanwhile: drop the swap entry instead
+        continue;
+      }
+      rss_add(myproc(), -PGSIZE);
+      if(n == 0)
+        kfree(P2V(pa));
     }
   }
   return newsz;
@@ -300,6 +684,7 @@ deallocuvm_p(pde_t *pgdir, uint oldsz, uint newsz, struct proc* p)
 {
   pte_t *pte;
   uint a, pa;
+  int n;
 
   if(newsz >= oldsz)
     return oldsz;
@@ -307,17 +692,34 @@ deallocuvm_p(pde_t *pgdir, uint oldsz, uint newsz, struct proc* p)
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte && !(pgdir[PDX(a)] & PTE_W)){
+      // A table shared after fork: drop it whole or make it private.
+      if(pgtab_release(pgdir, a, &n)){
+        rss_add(p, -n * PGSIZE);
+        a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+        continue;
+      }
+      pte = walkpgdir(pgdir, (char*)a, 0);
+    }
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if(*pte != 0 && !(*pte & PTE_P) && swap_drop(pte) == 0)
+      continue;
     else if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
-      char *v = P2V(pa);
-      update_ref_count(pa, -1, pte);
-      p->rss-=PGSIZE;
-      kfree(v);
-      *pte = 0;
+      if(iszeropage(pa)){
+        *pte = 0;
+        continue;
+      }
+      if((n = rmap_set(pa, pte, 0)) < 0){
+        a -= PGSIZE;
+        continue;
+      }
+      rss_add(p, -PGSIZE);
+      if(n == 0)
+        kfree(P2V(pa));
     }
   }
   return newsz;
@@ -378,79 +780,241 @@ clearpteu(pde_t *pgdir, char *uva)
 // In this lab we want to implement COW (Copy On Write) mechanism.
 // So instead of allocating new pages for the child process, we will just copy the parent's page table entries and mark them as read only.
 // Note that for simplicity we are assuming that same virtual page number of parent and child process may have the same physical page number.
+// Rather than copying PTEs one by one, the child shares each of the
+// parent's page-table pages (see pgtab_unshare), so fork costs one PDE
+// per 4MB of address space.
 pde_t*
 copyuvm(struct proc *p, pde_t *pgdir, uint sz)
 {
   pde_t *d;
-  pte_t *pte;
-  uint pa, i, flags;
-  // char *mem;
+  uint i;
 
   if((d = setupkvm()) == 0) // d contains the new page table (setupkvm() sets up the kernel part of the page table)
     return 0;
-  for(i = 0; i < sz; i += PGSIZE){ // loop over the parent's page table entries
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0) // get the page table entry for the virtual address i
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P)) {
-      swap_in(pte);
-    }
-      // panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte); // get the physical address of the page
-    *pte &= ~PTE_W; // mark the page as read only
-    flags = PTE_FLAGS(*pte); // get the flags of the page
-    
-    p->rss += PGSIZE;
-    if(mappages(d, (void*)i, PGSIZE, pa, flags,1) < 0) { // map the physical page to the child's page table entry
-      goto bad;
+  for(i = 0; i < sz; i = PGADDR(PDX(i) + 1, 0, 0)){
+    if(!(pgdir[PDX(i)] & PTE_P)) // lazily grown heap that was never touched
+      continue;
+    pgtab_ref(P2V(PTE_ADDR(pgdir[PDX(i)])));
+    pgdir[PDX(i)] &= ~PTE_W;
+    d[PDX(i)] = pgdir[PDX(i)];
+  }
+  rss_set(p, myproc()->rss);
+  tlb_flush_range(pgdir, 0, sz);  // the parent's pages are now read-only
+  return d;
+}
+
+// Give each mapping in dst its own reference to the same file as src.
+void
+vmacopy(struct vma *dst, struct vma *src)
+{
+  int i;
+
+  for(i = 0; i < NVMA; i++){
+    dst[i] = src[i];
+    if(dst[i].ip){
+      idup(dst[i].ip);
+      iexecmap(dst[i].ip, 1);
     }
+  }
+}
 
+// Drop the file mappings in vma. Must be in a transaction, for iput.
+void
+vmaclear(struct vma *vma)
+{
+  int i;
+
+  for(i = 0; i < NVMA; i++){
+    if(vma[i].ip){
+      iexecmap(vma[i].ip, -1);
+      iput(vma[i].ip);
+    }
+    vma[i].ip = 0;
   }
-  lcr3(V2P(pgdir));  // flush the TLB to save changes to the page table
-  return d;
+}
+
+static struct vma*
+vmalookup(struct proc *p, uint va)
+{
+  int i;
 
-bad:
-  freevm(d);
-  lcr3(V2P(pgdir));  // flush the TLB to save changes to the page table
+  for(i = 0; i < NVMA; i++)
+    if(p->vma[i].ip && va >= p->vma[i].start && va < p->vma[i].end)
+      return &p->vma[i];
   return 0;
 }
 
-void
-pagefault_handler(){
+// Give process p a fresh page at va, which was never mapped: either a
+// page of the program image, read from its file, or a page of heap that
+// was grown lazily, zeroed.
+static int
+lazyfault(struct proc *p, uint va)
+{
+  char *mem;
+  struct vma *v;
+  pte_t *pte;
+  uint n;
 
-  uint fault_addr = PGROUNDDOWN(rcr2());
+  if((v = vmalookup(p, va)) != 0 && va - v->start < v->filesz){
+    // Program pages come from the page cache, shared read-only by
+    // everyone running the binary until they write to them.
+    n = v->filesz - (va - v->start);
+    if(n > PGSIZE)
+      n = PGSIZE;
+    if((pte = walkpgdir(p->pgdir, (char*)va, 1)) == 0)
+      return -1;
+    if(pcache_map(v->ip, v->off + (va - v->start), n, pte) < 0)
+      return -1;
+    rss_add(p, PGSIZE);
+    atomic_inc(&faultstat.file);
+    return 0;
+  }
+  if((mem = kalloc_zeroed()) == 0)
+    return -1;
+  if(mappages(p->pgdir, (char*)va, PGSIZE, V2P(mem), PTE_W|PTE_U, 1) < 0){
+    kfree(mem);
+    return -1;
+  }
+  rss_add(p, PGSIZE);
+  atomic_inc(&faultstat.lazy);
+  return 0;
+}
 
+// Resolve a fault on user page fault_addr of the current process:
+// materialize a lazily grown heap page, swap the page back in, or
+// break COW / zero-page sharing. Returns 0 if the access should be
+// retried, -1 if fault_addr is not a valid user address.
+int
+uvmfault(uint fault_addr)
+{
   struct proc *curproc = myproc();
+
+  fault_addr = PGROUNDDOWN(fault_addr);
+  if(curproc == 0 || fault_addr >= curproc->sz)
+    return -1;
   // Get the page table of the current process
   pde_t *pgdir = curproc->pgdir;
   pte_t *pte = walkpgdir(pgdir, (void *) fault_addr, 0);
-  // sanity checks
-  if(pte == 0)
-    panic("pagefault_handler: pte should exist");
+  if(pte == 0 || *pte == 0)
+    return lazyfault(curproc, fault_addr);
   if(!(*pte & PTE_P)){
-    page_fault_handler();
-    return;
+    page_fault_handler(fault_addr);
+    return 0;
+  }
+  if(!(*pte & PTE_U)) // the guard page below the stack
+    return -1;
+  if(!(pgdir[PDX(fault_addr)] & PTE_W)){
+    // The page table is still shared with a fork relative.
+    if(pgtab_unshare(pgdir, fault_addr) < 0)
+      return -1;
+    pte = walkpgdir(pgdir, (void *) fault_addr, 0);
+    if(!(*pte & PTE_P))  // reclaimed while the table was copied
+      return 0;
   }
   uint pa = PTE_ADDR(*pte);
 
-  uint ref_count = get_count_ref(pa);
+  // A write to the zero page, or to a page still shared after fork or
+  // with the page cache: give this process its own copy. The zero page
+  // is never refcounted.
+  int zero = iszeropage(pa);
+  uint ref_count = zero ? 0 : get_count_ref(pa);
 
-  if (ref_count > 1){
-    update_ref_count(pa, -1, pte);
-    char *mem = kalloc();
-    if(mem == 0){
+  if (zero || ref_count > 1 || kpinned(pa)){
+    // The zero page only needs a cleared page; a COW copy overwrites it.
+    char *mem = zero ? kalloc_zeroed() : kalloc();
+    if(mem == 0 || rmap_reserve(1) < 0){
       cprintf("pagefault_handler: out of memory\n");
-      return;
+      if(mem)
+        kfree(mem);
+      return -1;
+    }
+    // kalloc() may have reclaimed memory and swapped out the very page
+    // we are copying, and kswapd may do so at any time. Hold a reference
+    // so the frame stays ours to read, and if it was swapped out, before
+    // or during the copy, let the access fault again.
+    if(!zero && kref_get(pa, pte) < 0){
+      rmap_unreserve(1);
+      kfree(mem);
+      return 0;
+    }
+    if(zero){
+      if(!(*pte & PTE_P) || PTE_ADDR(*pte) != pa){
+        rmap_unreserve(1);
+        kfree(mem);
+        return 0;
+      }
+      rss_add(curproc, PGSIZE);
+      atomic_inc(&faultstat.zero);
+    } else {
+      memmove(mem, (char*)P2V(pa), PGSIZE);
+      if(rmap_set(pa, pte, V2P(mem) | PTE_P | PTE_W | PTE_U) < 0){
+        rmap_unreserve(1);
+        kref_put(pa);
+        kfree(mem);
+        return 0;
+      }
+      kref_put(pa);  // frees pa if it was dropped from the page cache meanwhile
+      atomic_inc(&faultstat.cow);
     }
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
-    update_ref_count(V2P(mem),1,pte);
+    rmap_map(V2P(mem), pte, V2P(mem) | PTE_P | PTE_W | PTE_U);
   }
-  else{
-    *pte |= PTE_W;
-  }  
-  // Flush the TLB to save changes to the page table
-  lcr3(V2P(pgdir));
-  return;
+  else if(rmap_mkwrite(pa, pte) < 0){
+    // Merged with an identical page meanwhile: fault again and copy.
+    return 0;
+  }
+  tlb_flush_page(pgdir, fault_addr);
+  return 0;
+}
+
+int
+pagefault_handler(void)
+{
+  return uvmfault(rcr2());
+}
+
+// Make the user pages in [va, va+n) of the current process present, so
+// that the kernel can then access them without faulting, possibly while
+// holding a spinlock. Used by argptr(). If write is set the kernel will
+// store into the pages, so they must also be private and writable: a
+// zero-page, COW or shared page table mapping is broken here, as a write
+// fault would.
+int
+uvmprefault(uint va, uint n, int write)
+{
+  struct proc *curproc = myproc();
+  pte_t *pte;
+  uint a;
+
+  if(n == 0)
+    return 0;
+  for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE){
+    // A program page is first mapped read-only from the page cache, and
+    // uvmfault() gives up on a lost race, so check the page again.
+    for(;;){
+      pte = walkpgdir(curproc->pgdir, (void*)a, 0);
+      if(pte && (*pte & PTE_P) && (!write ||
+         ((*pte & PTE_W) && (curproc->pgdir[PDX(a)] & PTE_W))))
+        break;
+      if(uvmfault(a) < 0)
+        return -1;
+    }
+  }
+  return 0;
+}
+
+void
+vmfaultstat(struct vmstat *st)
+{
+  st->cow_faults = faultstat.cow;
+  st->zero_faults = faultstat.zero;
+  st->lazy_faults = faultstat.lazy;
+  st->file_faults = faultstat.file;
+  st->tlb_page = tlbstat.page;
+  st->tlb_range = tlbstat.range;
+  st->tlb_full = tlbstat.full;
+  st->tlb_skipped = tlbstat.skipped;
+  st->tlb_ipi = shootstat.ipi;
+  st->tlb_remote = shootstat.remote;
 }
 
 //PAGEBREAK!
@@ -461,7 +1025,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -479,8 +1043,21 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
     pa0 = uva2ka(pgdir, (char*)va0);
+    // The current process's page may be lazy, swapped out, or shared.
+    // copyout writes through the kernel mapping, which would bypass
+    // COW, so fault in a private writable copy first.
+    if(myproc() && pgdir == myproc()->pgdir &&
+       (pa0 == 0 || !(pgdir[PDX(va0)] & PTE_W) ||
+        !(*walkpgdir(pgdir, (char*)va0, 0) & PTE_W))){
+      if(uvmfault(va0) < 0)
+        return -1;
+      pa0 = uva2ka(pgdir, (char*)va0);
+    }
     if(pa0 == 0)
       return -1;
+    // The write bypasses the user mapping, so mark the page dirty by hand
+    // or a copy of it kept in swap would be taken as still current.
+    *walkpgdir(pgdir, (char*)va0, 0) |= PTE_D;
     n = PGSIZE - (va - va0);
     if(n > len)
       n = len;
@@ -0,0 +1,1367 @@
+
+_vmstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *policy[NSWAPPOLICY] = { "legacy", "clock", "aging", "wsclock" };
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  struct vmstat st;
+  uint below, bfree;
+  int i;
+
+  if(getvmstat(&st) < 0){
+  10:	8d 9d d8 fe ff ff    	lea    -0x128(%ebp),%ebx
+{
+  16:	51                   	push   %ecx
+  17:	81 ec 34 01 00 00    	sub    $0x134,%esp
+  if(getvmstat(&st) < 0){
+  1d:	53                   	push   %ebx
+  1e:	e8 c0 05 00 00       	call   5e3 <getvmstat>
+  23:	83 c4 10             	add    $0x10,%esp
+  26:	85 c0                	test   %eax,%eax
+  28:	0f 88 ae 02 00 00    	js     2dc <main+0x2dc>
+    printf(2, "vmstat: getvmstat failed\n");
+    exit();
+  }
+  printf(1, "free pages      %d (%d in per-cpu caches)\n", st.nfree, st.pcpfree);
+  2e:	ff b5 dc fe ff ff    	push   -0x124(%ebp)
+  printf(1, "swap read-ahead %d pages, %d used\n", st.swap_ra_pages, st.swap_ra_hits);
+  printf(1, "buffer cache    hits %d, misses %d\n", st.bcache_hits, st.bcache_misses);
+  printf(1, "reclaim         kswapd %d pages in %d wakeups, direct %d\n",
+         st.kswapd_pages, st.kswapd_wakeups, st.direct_reclaims);
+  printf(1, "policy  outs  ins  ticks  ins/1000 ticks\n");
+  for(i = 0; i < NSWAPPOLICY; i++)
+  34:	31 f6                	xor    %esi,%esi
+  printf(1, "free pages      %d (%d in per-cpu caches)\n", st.nfree, st.pcpfree);
+  36:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+  3c:	68 2c 0a 00 00       	push   $0xa2c
+  41:	6a 01                	push   $0x1
+  43:	e8 58 06 00 00       	call   6a0 <printf>
+  printf(1, "zero pool       %d (hits %d, misses %d)\n", st.zpool, st.zhits, st.zmisses);
+  48:	58                   	pop    %eax
+  49:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+  4f:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+  55:	ff b5 e0 fe ff ff    	push   -0x120(%ebp)
+  5b:	68 58 0a 00 00       	push   $0xa58
+  60:	6a 01                	push   $0x1
+  62:	e8 39 06 00 00       	call   6a0 <printf>
+  printf(1, "faults          cow %d, zero %d, lazy %d, file %d\n",
+  67:	83 c4 18             	add    $0x18,%esp
+  6a:	ff b5 30 ff ff ff    	push   -0xd0(%ebp)
+  70:	ff b5 2c ff ff ff    	push   -0xd4(%ebp)
+  76:	ff b5 28 ff ff ff    	push   -0xd8(%ebp)
+  7c:	ff b5 24 ff ff ff    	push   -0xdc(%ebp)
+  82:	68 84 0a 00 00       	push   $0xa84
+  87:	6a 01                	push   $0x1
+  89:	e8 12 06 00 00       	call   6a0 <printf>
+  printf(1, "page cache      %d pages (hits %d, misses %d)\n",
+  8e:	83 c4 14             	add    $0x14,%esp
+  91:	ff b5 3c ff ff ff    	push   -0xc4(%ebp)
+  97:	ff b5 38 ff ff ff    	push   -0xc8(%ebp)
+  9d:	ff b5 34 ff ff ff    	push   -0xcc(%ebp)
+  a3:	68 b8 0a 00 00       	push   $0xab8
+  a8:	6a 01                	push   $0x1
+  aa:	e8 f1 05 00 00       	call   6a0 <printf>
+  printf(1, "tlb flushes     page %d, range %d, full %d, skipped %d\n",
+  af:	83 c4 18             	add    $0x18,%esp
+  b2:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+  b8:	ff b5 48 ff ff ff    	push   -0xb8(%ebp)
+  be:	ff b5 44 ff ff ff    	push   -0xbc(%ebp)
+  c4:	ff b5 40 ff ff ff    	push   -0xc0(%ebp)
+  ca:	68 e8 0a 00 00       	push   $0xae8
+  cf:	6a 01                	push   $0x1
+  d1:	e8 ca 05 00 00       	call   6a0 <printf>
+  printf(1, "tlb shootdowns  ipis %d, remote %d\n", st.tlb_ipi, st.tlb_remote);
+  d6:	83 c4 20             	add    $0x20,%esp
+  d9:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  df:	ff b5 50 ff ff ff    	push   -0xb0(%ebp)
+  e5:	68 20 0b 00 00       	push   $0xb20
+  ea:	6a 01                	push   $0x1
+  ec:	e8 af 05 00 00       	call   6a0 <printf>
+  printf(1, "same-page merge scanned %d, saved %d, failed %d\n",
+  f1:	5a                   	pop    %edx
+  f2:	ff b5 60 ff ff ff    	push   -0xa0(%ebp)
+  f8:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+  fe:	ff b5 58 ff ff ff    	push   -0xa8(%ebp)
+ 104:	68 44 0b 00 00       	push   $0xb44
+ 109:	6a 01                	push   $0x1
+ 10b:	e8 90 05 00 00       	call   6a0 <printf>
+  printf(1, "zswap           %d pages hold %d swapped pages in %d bytes (%d to disk)\n",
+ 110:	83 c4 18             	add    $0x18,%esp
+ 113:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+ 119:	ff b5 6c ff ff ff    	push   -0x94(%ebp)
+ 11f:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+ 125:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+ 12b:	68 78 0b 00 00       	push   $0xb78
+ 130:	6a 01                	push   $0x1
+ 132:	e8 69 05 00 00       	call   6a0 <printf>
+  printf(1, "swap slots      %d of %d used, longest free run %d\n",
+ 137:	83 c4 14             	add    $0x14,%esp
+ 13a:	ff b5 7c ff ff ff    	push   -0x84(%ebp)
+ 140:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+ 146:	ff b5 78 ff ff ff    	push   -0x88(%ebp)
+ 14c:	68 c4 0b 00 00       	push   $0xbc4
+ 151:	6a 01                	push   $0x1
+ 153:	e8 48 05 00 00       	call   6a0 <printf>
+  printf(1, "swap cache      %d slots, %d clean evictions, %d shared faults\n",
+ 158:	83 c4 14             	add    $0x14,%esp
+ 15b:	ff 75 88             	push   -0x78(%ebp)
+ 15e:	ff 75 84             	push   -0x7c(%ebp)
+ 161:	ff 75 80             	push   -0x80(%ebp)
+ 164:	68 f8 0b 00 00       	push   $0xbf8
+ 169:	6a 01                	push   $0x1
+ 16b:	e8 30 05 00 00       	call   6a0 <printf>
+  printf(1, "swap i/o        %d reads, %d writes in %d ticks\n",
+ 170:	83 c4 14             	add    $0x14,%esp
+ 173:	ff 75 9c             	push   -0x64(%ebp)
+ 176:	ff 75 98             	push   -0x68(%ebp)
+ 179:	ff 75 94             	push   -0x6c(%ebp)
+ 17c:	68 38 0c 00 00       	push   $0xc38
+ 181:	6a 01                	push   $0x1
+ 183:	e8 18 05 00 00       	call   6a0 <printf>
+  printf(1, "swap read-ahead %d pages, %d used\n", st.swap_ra_pages, st.swap_ra_hits);
+ 188:	83 c4 20             	add    $0x20,%esp
+ 18b:	ff 75 90             	push   -0x70(%ebp)
+ 18e:	ff 75 8c             	push   -0x74(%ebp)
+ 191:	68 6c 0c 00 00       	push   $0xc6c
+ 196:	6a 01                	push   $0x1
+ 198:	e8 03 05 00 00       	call   6a0 <printf>
+  printf(1, "buffer cache    hits %d, misses %d\n", st.bcache_hits, st.bcache_misses);
+ 19d:	ff 75 a4             	push   -0x5c(%ebp)
+ 1a0:	ff 75 a0             	push   -0x60(%ebp)
+ 1a3:	68 90 0c 00 00       	push   $0xc90
+ 1a8:	6a 01                	push   $0x1
+ 1aa:	e8 f1 04 00 00       	call   6a0 <printf>
+  printf(1, "reclaim         kswapd %d pages in %d wakeups, direct %d\n",
+ 1af:	83 c4 14             	add    $0x14,%esp
+ 1b2:	ff 75 b0             	push   -0x50(%ebp)
+ 1b5:	ff 75 a8             	push   -0x58(%ebp)
+ 1b8:	ff 75 ac             	push   -0x54(%ebp)
+ 1bb:	68 b4 0c 00 00       	push   $0xcb4
+ 1c0:	6a 01                	push   $0x1
+ 1c2:	e8 d9 04 00 00       	call   6a0 <printf>
+  printf(1, "policy  outs  ins  ticks  ins/1000 ticks\n");
+ 1c7:	83 c4 18             	add    $0x18,%esp
+ 1ca:	68 f0 0c 00 00       	push   $0xcf0
+ 1cf:	6a 01                	push   $0x1
+ 1d1:	e8 ca 04 00 00       	call   6a0 <printf>
+ 1d6:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%s%s  %d  %d  %d  %d\n", policy[i], i == st.swap_policy ? "*" : "",
+           st.swap_outs[i], st.swap_ins[i], st.swap_ticks[i],
+           st.swap_ticks[i] ? st.swap_ins[i] * 1000 / st.swap_ticks[i] : 0);
+ 1d9:	8b 8c b3 00 01 00 00 	mov    0x100(%ebx,%esi,4),%ecx
+ 1e0:	8b bc b3 f0 00 00 00 	mov    0xf0(%ebx,%esi,4),%edi
+    printf(1, "%s%s  %d  %d  %d  %d\n", policy[i], i == st.swap_policy ? "*" : "",
+ 1e7:	c7 85 d4 fe ff ff 00 	movl   $0x0,-0x12c(%ebp)
+ 1ee:	00 00 00 
+ 1f1:	85 c9                	test   %ecx,%ecx
+ 1f3:	74 10                	je     205 <main+0x205>
+           st.swap_ticks[i] ? st.swap_ins[i] * 1000 / st.swap_ticks[i] : 0);
+ 1f5:	69 c7 e8 03 00 00    	imul   $0x3e8,%edi,%eax
+    printf(1, "%s%s  %d  %d  %d  %d\n", policy[i], i == st.swap_policy ? "*" : "",
+ 1fb:	31 d2                	xor    %edx,%edx
+ 1fd:	f7 f1                	div    %ecx
+ 1ff:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+ 205:	39 75 b4             	cmp    %esi,-0x4c(%ebp)
+ 208:	b8 14 0a 00 00       	mov    $0xa14,%eax
+ 20d:	ba c8 09 00 00       	mov    $0x9c8,%edx
+ 212:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+ 218:	0f 45 d0             	cmovne %eax,%edx
+ 21b:	51                   	push   %ecx
+ 21c:	57                   	push   %edi
+ 21d:	ff b4 b3 e0 00 00 00 	push   0xe0(%ebx,%esi,4)
+ 224:	52                   	push   %edx
+ 225:	ff 34 b5 5c 10 00 00 	push   0x105c(,%esi,4)
+  for(i = 0; i < NSWAPPOLICY; i++)
+ 22c:	83 c6 01             	add    $0x1,%esi
+    printf(1, "%s%s  %d  %d  %d  %d\n", policy[i], i == st.swap_policy ? "*" : "",
+ 22f:	68 e4 09 00 00       	push   $0x9e4
+ 234:	6a 01                	push   $0x1
+ 236:	e8 65 04 00 00       	call   6a0 <printf>
+  for(i = 0; i < NSWAPPOLICY; i++)
+ 23b:	83 c4 20             	add    $0x20,%esp
+ 23e:	83 fe 04             	cmp    $0x4,%esi
+ 241:	75 96                	jne    1d9 <main+0x1d9>
+  printf(1, "rmap bytes      %d (%d pool pages, %d nodes in use)\n",
+ 243:	83 ec 0c             	sub    $0xc,%esp
+ 246:	ff b5 20 ff ff ff    	push   -0xe0(%ebp)
+  // Fragmentation: for each order, the share of free memory that sits
+  // in smaller blocks and so cannot satisfy a request of that order.
+  bfree = st.nfree - st.pcpfree - st.zpool;
+  printf(1, "order  blocks  unusable%%\n");
+  below = 0;
+  for(i = 0; i < NORDER; i++){
+ 24c:	31 ff                	xor    %edi,%edi
+  below = 0;
+ 24e:	31 f6                	xor    %esi,%esi
+  printf(1, "rmap bytes      %d (%d pool pages, %d nodes in use)\n",
+ 250:	ff b5 1c ff ff ff    	push   -0xe4(%ebp)
+ 256:	ff b5 18 ff ff ff    	push   -0xe8(%ebp)
+ 25c:	68 1c 0d 00 00       	push   $0xd1c
+ 261:	6a 01                	push   $0x1
+ 263:	e8 38 04 00 00       	call   6a0 <printf>
+  bfree = st.nfree - st.pcpfree - st.zpool;
+ 268:	8b 8d d8 fe ff ff    	mov    -0x128(%ebp),%ecx
+ 26e:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+  printf(1, "order  blocks  unusable%%\n");
+ 274:	83 c4 18             	add    $0x18,%esp
+  bfree = st.nfree - st.pcpfree - st.zpool;
+ 277:	03 85 dc fe ff ff    	add    -0x124(%ebp),%eax
+ 27d:	29 c1                	sub    %eax,%ecx
+ 27f:	89 8d d4 fe ff ff    	mov    %ecx,-0x12c(%ebp)
+  printf(1, "order  blocks  unusable%%\n");
+ 285:	68 fa 09 00 00       	push   $0x9fa
+ 28a:	6a 01                	push   $0x1
+ 28c:	e8 0f 04 00 00       	call   6a0 <printf>
+ 291:	83 c4 10             	add    $0x10,%esp
+ 294:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "%d  %d  %d\n", i, st.nblocks[i], bfree ? below * 100 / bfree : 0);
+ 298:	8b 95 d4 fe ff ff    	mov    -0x12c(%ebp),%edx
+ 29e:	31 c0                	xor    %eax,%eax
+ 2a0:	85 d2                	test   %edx,%edx
+ 2a2:	74 09                	je     2ad <main+0x2ad>
+ 2a4:	6b c6 64             	imul   $0x64,%esi,%eax
+ 2a7:	89 d1                	mov    %edx,%ecx
+ 2a9:	31 d2                	xor    %edx,%edx
+ 2ab:	f7 f1                	div    %ecx
+ 2ad:	83 ec 0c             	sub    $0xc,%esp
+ 2b0:	50                   	push   %eax
+ 2b1:	ff 74 bb 14          	push   0x14(%ebx,%edi,4)
+ 2b5:	57                   	push   %edi
+ 2b6:	68 ee 09 00 00       	push   $0x9ee
+ 2bb:	6a 01                	push   $0x1
+ 2bd:	e8 de 03 00 00       	call   6a0 <printf>
+    below += st.nblocks[i] << i;
+ 2c2:	8b 44 bb 14          	mov    0x14(%ebx,%edi,4),%eax
+ 2c6:	89 f9                	mov    %edi,%ecx
+  for(i = 0; i < NORDER; i++){
+ 2c8:	83 c7 01             	add    $0x1,%edi
+ 2cb:	83 c4 20             	add    $0x20,%esp
+    below += st.nblocks[i] << i;
+ 2ce:	d3 e0                	shl    %cl,%eax
+ 2d0:	01 c6                	add    %eax,%esi
+  for(i = 0; i < NORDER; i++){
+ 2d2:	83 ff 0b             	cmp    $0xb,%edi
+ 2d5:	75 c1                	jne    298 <main+0x298>
+  }
+  exit();
+ 2d7:	e8 57 02 00 00       	call   533 <exit>
+    printf(2, "vmstat: getvmstat failed\n");
+ 2dc:	51                   	push   %ecx
+ 2dd:	51                   	push   %ecx
+ 2de:	68 ca 09 00 00       	push   $0x9ca
+ 2e3:	6a 02                	push   $0x2
+ 2e5:	e8 b6 03 00 00       	call   6a0 <printf>
+    exit();
+ 2ea:	e8 44 02 00 00       	call   533 <exit>
+ 2ef:	90                   	nop
+
+000002f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2f1:	31 c0                	xor    %eax,%eax
+{
+ 2f3:	89 e5                	mov    %esp,%ebp
+ 2f5:	53                   	push   %ebx
+ 2f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 300:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 304:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 307:	83 c0 01             	add    $0x1,%eax
+ 30a:	84 d2                	test   %dl,%dl
+ 30c:	75 f2                	jne    300 <strcpy+0x10>
+    ;
+  return os;
+}
+ 30e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 311:	89 c8                	mov    %ecx,%eax
+ 313:	c9                   	leave
+ 314:	c3                   	ret
+ 315:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+ 327:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 32a:	0f b6 02             	movzbl (%edx),%eax
+ 32d:	84 c0                	test   %al,%al
+ 32f:	75 17                	jne    348 <strcmp+0x28>
+ 331:	eb 3a                	jmp    36d <strcmp+0x4d>
+ 333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 337:	90                   	nop
+ 338:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 33c:	83 c2 01             	add    $0x1,%edx
+ 33f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 342:	84 c0                	test   %al,%al
+ 344:	74 1a                	je     360 <strcmp+0x40>
+    p++, q++;
+ 346:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 348:	0f b6 19             	movzbl (%ecx),%ebx
+ 34b:	38 c3                	cmp    %al,%bl
+ 34d:	74 e9                	je     338 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 34f:	29 d8                	sub    %ebx,%eax
+}
+ 351:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 354:	c9                   	leave
+ 355:	c3                   	ret
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 360:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 364:	31 c0                	xor    %eax,%eax
+ 366:	29 d8                	sub    %ebx,%eax
+}
+ 368:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 36b:	c9                   	leave
+ 36c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 36d:	0f b6 19             	movzbl (%ecx),%ebx
+ 370:	31 c0                	xor    %eax,%eax
+ 372:	eb db                	jmp    34f <strcmp+0x2f>
+ 374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 386:	80 3a 00             	cmpb   $0x0,(%edx)
+ 389:	74 15                	je     3a0 <strlen+0x20>
+ 38b:	31 c0                	xor    %eax,%eax
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+ 390:	83 c0 01             	add    $0x1,%eax
+ 393:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 397:	89 c1                	mov    %eax,%ecx
+ 399:	75 f5                	jne    390 <strlen+0x10>
+    ;
+  return n;
+}
+ 39b:	89 c8                	mov    %ecx,%eax
+ 39d:	5d                   	pop    %ebp
+ 39e:	c3                   	ret
+ 39f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3a0:	31 c9                	xor    %ecx,%ecx
+}
+ 3a2:	5d                   	pop    %ebp
+ 3a3:	89 c8                	mov    %ecx,%eax
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3bd:	89 d7                	mov    %edx,%edi
+ 3bf:	fc                   	cld
+ 3c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3c5:	89 d0                	mov    %edx,%eax
+ 3c7:	c9                   	leave
+ 3c8:	c3                   	ret
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3da:	0f b6 10             	movzbl (%eax),%edx
+ 3dd:	84 d2                	test   %dl,%dl
+ 3df:	75 12                	jne    3f3 <strchr+0x23>
+ 3e1:	eb 1d                	jmp    400 <strchr+0x30>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3ec:	83 c0 01             	add    $0x1,%eax
+ 3ef:	84 d2                	test   %dl,%dl
+ 3f1:	74 0d                	je     400 <strchr+0x30>
+    if(*s == c)
+ 3f3:	38 d1                	cmp    %dl,%cl
+ 3f5:	75 f1                	jne    3e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3f7:	5d                   	pop    %ebp
+ 3f8:	c3                   	ret
+ 3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 400:	31 c0                	xor    %eax,%eax
+}
+ 402:	5d                   	pop    %ebp
+ 403:	c3                   	ret
+ 404:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 40f:	90                   	nop
+
+00000410 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 415:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 418:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 419:	31 db                	xor    %ebx,%ebx
+{
+ 41b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 41e:	eb 27                	jmp    447 <gets+0x37>
+    cc = read(0, &c, 1);
+ 420:	83 ec 04             	sub    $0x4,%esp
+ 423:	6a 01                	push   $0x1
+ 425:	56                   	push   %esi
+ 426:	6a 00                	push   $0x0
+ 428:	e8 1e 01 00 00       	call   54b <read>
+    if(cc < 1)
+ 42d:	83 c4 10             	add    $0x10,%esp
+ 430:	85 c0                	test   %eax,%eax
+ 432:	7e 1d                	jle    451 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 434:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 438:	8b 55 08             	mov    0x8(%ebp),%edx
+ 43b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 43f:	3c 0a                	cmp    $0xa,%al
+ 441:	74 10                	je     453 <gets+0x43>
+ 443:	3c 0d                	cmp    $0xd,%al
+ 445:	74 0c                	je     453 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 447:	89 df                	mov    %ebx,%edi
+ 449:	83 c3 01             	add    $0x1,%ebx
+ 44c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 44f:	7c cf                	jl     420 <gets+0x10>
+ 451:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 45a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 45d:	5b                   	pop    %ebx
+ 45e:	5e                   	pop    %esi
+ 45f:	5f                   	pop    %edi
+ 460:	5d                   	pop    %ebp
+ 461:	c3                   	ret
+ 462:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	56                   	push   %esi
+ 474:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 475:	83 ec 08             	sub    $0x8,%esp
+ 478:	6a 00                	push   $0x0
+ 47a:	ff 75 08             	push   0x8(%ebp)
+ 47d:	e8 f1 00 00 00       	call   573 <open>
+  if(fd < 0)
+ 482:	83 c4 10             	add    $0x10,%esp
+ 485:	85 c0                	test   %eax,%eax
+ 487:	78 27                	js     4b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 489:	83 ec 08             	sub    $0x8,%esp
+ 48c:	ff 75 0c             	push   0xc(%ebp)
+ 48f:	89 c3                	mov    %eax,%ebx
+ 491:	50                   	push   %eax
+ 492:	e8 f4 00 00 00       	call   58b <fstat>
+  close(fd);
+ 497:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 49a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 49c:	e8 ba 00 00 00       	call   55b <close>
+  return r;
+ 4a1:	83 c4 10             	add    $0x10,%esp
+}
+ 4a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4a7:	89 f0                	mov    %esi,%eax
+ 4a9:	5b                   	pop    %ebx
+ 4aa:	5e                   	pop    %esi
+ 4ab:	5d                   	pop    %ebp
+ 4ac:	c3                   	ret
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4b5:	eb ed                	jmp    4a4 <stat+0x34>
+ 4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	53                   	push   %ebx
+ 4c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4c7:	0f be 02             	movsbl (%edx),%eax
+ 4ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4d5:	77 1e                	ja     4f5 <atoi+0x35>
+ 4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4e0:	83 c2 01             	add    $0x1,%edx
+ 4e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ea:	0f be 02             	movsbl (%edx),%eax
+ 4ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4f0:	80 fb 09             	cmp    $0x9,%bl
+ 4f3:	76 eb                	jbe    4e0 <atoi+0x20>
+  return n;
+}
+ 4f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4f8:	89 c8                	mov    %ecx,%eax
+ 4fa:	c9                   	leave
+ 4fb:	c3                   	ret
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	56                   	push   %esi
+ 505:	8b 45 10             	mov    0x10(%ebp),%eax
+ 508:	8b 55 08             	mov    0x8(%ebp),%edx
+ 50b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 50e:	85 c0                	test   %eax,%eax
+ 510:	7e 13                	jle    525 <memmove+0x25>
+ 512:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 514:	89 d7                	mov    %edx,%edi
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 520:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 521:	39 f8                	cmp    %edi,%eax
+ 523:	75 fb                	jne    520 <memmove+0x20>
+  return vdst;
+}
+ 525:	5e                   	pop    %esi
+ 526:	89 d0                	mov    %edx,%eax
+ 528:	5f                   	pop    %edi
+ 529:	5d                   	pop    %ebp
+ 52a:	c3                   	ret
+
+0000052b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 52b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <exit>:
+SYSCALL(exit)
+ 533:	b8 02 00 00 00       	mov    $0x2,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <wait>:
+SYSCALL(wait)
+ 53b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <pipe>:
+SYSCALL(pipe)
+ 543:	b8 04 00 00 00       	mov    $0x4,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <read>:
+SYSCALL(read)
+ 54b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <write>:
+SYSCALL(write)
+ 553:	b8 10 00 00 00       	mov    $0x10,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <close>:
+SYSCALL(close)
+ 55b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <kill>:
+SYSCALL(kill)
+ 563:	b8 06 00 00 00       	mov    $0x6,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <exec>:
+SYSCALL(exec)
+ 56b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <open>:
+SYSCALL(open)
+ 573:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <mknod>:
+SYSCALL(mknod)
+ 57b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <unlink>:
+SYSCALL(unlink)
+ 583:	b8 12 00 00 00       	mov    $0x12,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <fstat>:
+SYSCALL(fstat)
+ 58b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <link>:
+SYSCALL(link)
+ 593:	b8 13 00 00 00       	mov    $0x13,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <mkdir>:
+SYSCALL(mkdir)
+ 59b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <chdir>:
+SYSCALL(chdir)
+ 5a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <dup>:
+SYSCALL(dup)
+ 5ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <getpid>:
+SYSCALL(getpid)
+ 5b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <sbrk>:
+SYSCALL(sbrk)
+ 5bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <sleep>:
+SYSCALL(sleep)
+ 5c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <uptime>:
+SYSCALL(uptime)
+ 5cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <getrss>:
+SYSCALL(getrss)
+ 5d3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <getNumFreePages>:
+SYSCALL(getNumFreePages)
+ 5db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <getvmstat>:
+SYSCALL(getvmstat)
+ 5e3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <vmctl>:
+SYSCALL(vmctl)
+ 5eb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <spawn>:
+SYSCALL(spawn)
+ 5f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+ 5fb:	66 90                	xchg   %ax,%ax
+ 5fd:	66 90                	xchg   %ax,%ax
+ 5ff:	90                   	nop
+
+00000600 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	53                   	push   %ebx
+ 606:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 608:	89 d1                	mov    %edx,%ecx
+{
+ 60a:	83 ec 3c             	sub    $0x3c,%esp
+ 60d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 610:	85 d2                	test   %edx,%edx
+ 612:	0f 89 80 00 00 00    	jns    698 <printint+0x98>
+ 618:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 61c:	74 7a                	je     698 <printint+0x98>
+    x = -xx;
+ 61e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 620:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 625:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 628:	31 f6                	xor    %esi,%esi
+ 62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 630:	89 c8                	mov    %ecx,%eax
+ 632:	31 d2                	xor    %edx,%edx
+ 634:	89 f7                	mov    %esi,%edi
+ 636:	f7 f3                	div    %ebx
+ 638:	8d 76 01             	lea    0x1(%esi),%esi
+ 63b:	0f b6 92 b0 0d 00 00 	movzbl 0xdb0(%edx),%edx
+ 642:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 646:	89 ca                	mov    %ecx,%edx
+ 648:	89 c1                	mov    %eax,%ecx
+ 64a:	39 da                	cmp    %ebx,%edx
+ 64c:	73 e2                	jae    630 <printint+0x30>
+  if(neg)
+ 64e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 651:	85 c0                	test   %eax,%eax
+ 653:	74 07                	je     65c <printint+0x5c>
+    buf[i++] = '-';
+ 655:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 65a:	89 f7                	mov    %esi,%edi
+ 65c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 65f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 662:	01 df                	add    %ebx,%edi
+ 664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 668:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 66b:	83 ec 04             	sub    $0x4,%esp
+ 66e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 671:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 674:	6a 01                	push   $0x1
+ 676:	50                   	push   %eax
+ 677:	56                   	push   %esi
+ 678:	e8 d6 fe ff ff       	call   553 <write>
+  while(--i >= 0)
+ 67d:	89 f8                	mov    %edi,%eax
+ 67f:	83 c4 10             	add    $0x10,%esp
+ 682:	83 ef 01             	sub    $0x1,%edi
+ 685:	39 d8                	cmp    %ebx,%eax
+ 687:	75 df                	jne    668 <printint+0x68>
+}
+ 689:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 68c:	5b                   	pop    %ebx
+ 68d:	5e                   	pop    %esi
+ 68e:	5f                   	pop    %edi
+ 68f:	5d                   	pop    %ebp
+ 690:	c3                   	ret
+ 691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 698:	31 c0                	xor    %eax,%eax
+ 69a:	eb 89                	jmp    625 <printint+0x25>
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	53                   	push   %ebx
+ 6a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6af:	0f b6 1e             	movzbl (%esi),%ebx
+ 6b2:	83 c6 01             	add    $0x1,%esi
+ 6b5:	84 db                	test   %bl,%bl
+ 6b7:	74 67                	je     720 <printf+0x80>
+ 6b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6bc:	31 d2                	xor    %edx,%edx
+ 6be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6c1:	eb 34                	jmp    6f7 <printf+0x57>
+ 6c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6c7:	90                   	nop
+ 6c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6d0:	83 f8 25             	cmp    $0x25,%eax
+ 6d3:	74 18                	je     6ed <printf+0x4d>
+  write(fd, &c, 1);
+ 6d5:	83 ec 04             	sub    $0x4,%esp
+ 6d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6de:	6a 01                	push   $0x1
+ 6e0:	50                   	push   %eax
+ 6e1:	57                   	push   %edi
+ 6e2:	e8 6c fe ff ff       	call   553 <write>
+ 6e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 6f0:	83 c6 01             	add    $0x1,%esi
+ 6f3:	84 db                	test   %bl,%bl
+ 6f5:	74 29                	je     720 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6fa:	85 d2                	test   %edx,%edx
+ 6fc:	74 ca                	je     6c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6fe:	83 fa 25             	cmp    $0x25,%edx
+ 701:	75 ea                	jne    6ed <printf+0x4d>
+      if(c == 'd'){
+ 703:	83 f8 25             	cmp    $0x25,%eax
+ 706:	0f 84 24 01 00 00    	je     830 <printf+0x190>
+ 70c:	83 e8 63             	sub    $0x63,%eax
+ 70f:	83 f8 15             	cmp    $0x15,%eax
+ 712:	77 1c                	ja     730 <printf+0x90>
+ 714:	ff 24 85 58 0d 00 00 	jmp    *0xd58(,%eax,4)
+ 71b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 71f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 723:	5b                   	pop    %ebx
+ 724:	5e                   	pop    %esi
+ 725:	5f                   	pop    %edi
+ 726:	5d                   	pop    %ebp
+ 727:	c3                   	ret
+ 728:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72f:	90                   	nop
+  write(fd, &c, 1);
+ 730:	83 ec 04             	sub    $0x4,%esp
+ 733:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 736:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 73a:	6a 01                	push   $0x1
+ 73c:	52                   	push   %edx
+ 73d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 740:	57                   	push   %edi
+ 741:	e8 0d fe ff ff       	call   553 <write>
+ 746:	83 c4 0c             	add    $0xc,%esp
+ 749:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 74c:	6a 01                	push   $0x1
+ 74e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 751:	52                   	push   %edx
+ 752:	57                   	push   %edi
+ 753:	e8 fb fd ff ff       	call   553 <write>
+        putc(fd, c);
+ 758:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 75b:	31 d2                	xor    %edx,%edx
+ 75d:	eb 8e                	jmp    6ed <printf+0x4d>
+ 75f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 760:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 763:	83 ec 0c             	sub    $0xc,%esp
+ 766:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 76b:	8b 13                	mov    (%ebx),%edx
+ 76d:	6a 00                	push   $0x0
+ 76f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 771:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 774:	e8 87 fe ff ff       	call   600 <printint>
+        ap++;
+ 779:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 77c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 77f:	31 d2                	xor    %edx,%edx
+ 781:	e9 67 ff ff ff       	jmp    6ed <printf+0x4d>
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 790:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 793:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 795:	83 c0 04             	add    $0x4,%eax
+ 798:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 79b:	85 db                	test   %ebx,%ebx
+ 79d:	0f 84 9d 00 00 00    	je     840 <printf+0x1a0>
+        while(*s != 0){
+ 7a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7a8:	84 c0                	test   %al,%al
+ 7aa:	0f 84 3d ff ff ff    	je     6ed <printf+0x4d>
+ 7b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7b6:	89 de                	mov    %ebx,%esi
+ 7b8:	89 d3                	mov    %edx,%ebx
+ 7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	53                   	push   %ebx
+ 7cc:	57                   	push   %edi
+ 7cd:	e8 81 fd ff ff       	call   553 <write>
+        while(*s != 0){
+ 7d2:	0f b6 06             	movzbl (%esi),%eax
+ 7d5:	83 c4 10             	add    $0x10,%esp
+ 7d8:	84 c0                	test   %al,%al
+ 7da:	75 e4                	jne    7c0 <printf+0x120>
+      state = 0;
+ 7dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7df:	31 d2                	xor    %edx,%edx
+ 7e1:	e9 07 ff ff ff       	jmp    6ed <printf+0x4d>
+ 7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7f3:	83 ec 0c             	sub    $0xc,%esp
+ 7f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7fb:	8b 13                	mov    (%ebx),%edx
+ 7fd:	6a 01                	push   $0x1
+ 7ff:	e9 6b ff ff ff       	jmp    76f <printf+0xcf>
+ 804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 808:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 80b:	83 ec 04             	sub    $0x4,%esp
+ 80e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 811:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 813:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 816:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 819:	6a 01                	push   $0x1
+ 81b:	52                   	push   %edx
+ 81c:	57                   	push   %edi
+ 81d:	e8 31 fd ff ff       	call   553 <write>
+        ap++;
+ 822:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 825:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 828:	31 d2                	xor    %edx,%edx
+ 82a:	e9 be fe ff ff       	jmp    6ed <printf+0x4d>
+ 82f:	90                   	nop
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 836:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 839:	6a 01                	push   $0x1
+ 83b:	e9 11 ff ff ff       	jmp    751 <printf+0xb1>
+ 840:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 845:	bb 51 0d 00 00       	mov    $0xd51,%ebx
+ 84a:	e9 61 ff ff ff       	jmp    7b0 <printf+0x110>
+ 84f:	90                   	nop
+
+00000850 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 850:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 851:	a1 6c 10 00 00       	mov    0x106c,%eax
+{
+ 856:	89 e5                	mov    %esp,%ebp
+ 858:	57                   	push   %edi
+ 859:	56                   	push   %esi
+ 85a:	53                   	push   %ebx
+ 85b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 85e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 861:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 868:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 86a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 86c:	39 ca                	cmp    %ecx,%edx
+ 86e:	73 30                	jae    8a0 <free+0x50>
+ 870:	39 c1                	cmp    %eax,%ecx
+ 872:	72 04                	jb     878 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 874:	39 c2                	cmp    %eax,%edx
+ 876:	72 f0                	jb     868 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 878:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 87b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 87e:	39 f8                	cmp    %edi,%eax
+ 880:	74 2e                	je     8b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 882:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 885:	8b 42 04             	mov    0x4(%edx),%eax
+ 888:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 88b:	39 f1                	cmp    %esi,%ecx
+ 88d:	74 38                	je     8c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 88f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 891:	5b                   	pop    %ebx
+  freep = p;
+ 892:	89 15 6c 10 00 00    	mov    %edx,0x106c
+}
+ 898:	5e                   	pop    %esi
+ 899:	5f                   	pop    %edi
+ 89a:	5d                   	pop    %ebp
+ 89b:	c3                   	ret
+ 89c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8a0:	39 c1                	cmp    %eax,%ecx
+ 8a2:	72 d0                	jb     874 <free+0x24>
+ 8a4:	eb c2                	jmp    868 <free+0x18>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8b0:	03 70 04             	add    0x4(%eax),%esi
+ 8b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8b6:	8b 02                	mov    (%edx),%eax
+ 8b8:	8b 00                	mov    (%eax),%eax
+ 8ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8bd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8c3:	39 f1                	cmp    %esi,%ecx
+ 8c5:	75 c8                	jne    88f <free+0x3f>
+    p->s.size += bp->s.size;
+ 8c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8ca:	89 15 6c 10 00 00    	mov    %edx,0x106c
+    p->s.size += bp->s.size;
+ 8d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8d6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8d8:	5b                   	pop    %ebx
+ 8d9:	5e                   	pop    %esi
+ 8da:	5f                   	pop    %edi
+ 8db:	5d                   	pop    %ebp
+ 8dc:	c3                   	ret
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8ec:	8b 15 6c 10 00 00    	mov    0x106c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8f2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8f5:	c1 ef 03             	shr    $0x3,%edi
+ 8f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8fb:	85 d2                	test   %edx,%edx
+ 8fd:	0f 84 8d 00 00 00    	je     990 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 903:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 905:	8b 48 04             	mov    0x4(%eax),%ecx
+ 908:	39 f9                	cmp    %edi,%ecx
+ 90a:	73 64                	jae    970 <malloc+0x90>
+  if(nu < 4096)
+ 90c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 911:	39 df                	cmp    %ebx,%edi
+ 913:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 916:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 91d:	eb 0a                	jmp    929 <malloc+0x49>
+ 91f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 920:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 922:	8b 48 04             	mov    0x4(%eax),%ecx
+ 925:	39 f9                	cmp    %edi,%ecx
+ 927:	73 47                	jae    970 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 929:	89 c2                	mov    %eax,%edx
+ 92b:	39 05 6c 10 00 00    	cmp    %eax,0x106c
+ 931:	75 ed                	jne    920 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 933:	83 ec 0c             	sub    $0xc,%esp
+ 936:	56                   	push   %esi
+ 937:	e8 7f fc ff ff       	call   5bb <sbrk>
+  if(p == (char*)-1)
+ 93c:	83 c4 10             	add    $0x10,%esp
+ 93f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 942:	74 1c                	je     960 <malloc+0x80>
+  hp->s.size = nu;
+ 944:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 947:	83 ec 0c             	sub    $0xc,%esp
+ 94a:	83 c0 08             	add    $0x8,%eax
+ 94d:	50                   	push   %eax
+ 94e:	e8 fd fe ff ff       	call   850 <free>
+  return freep;
+ 953:	8b 15 6c 10 00 00    	mov    0x106c,%edx
+      if((p = morecore(nunits)) == 0)
+ 959:	83 c4 10             	add    $0x10,%esp
+ 95c:	85 d2                	test   %edx,%edx
+ 95e:	75 c0                	jne    920 <malloc+0x40>
+        return 0;
+  }
+}
+ 960:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 963:	31 c0                	xor    %eax,%eax
+}
+ 965:	5b                   	pop    %ebx
+ 966:	5e                   	pop    %esi
+ 967:	5f                   	pop    %edi
+ 968:	5d                   	pop    %ebp
+ 969:	c3                   	ret
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 970:	39 cf                	cmp    %ecx,%edi
+ 972:	74 4c                	je     9c0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 974:	29 f9                	sub    %edi,%ecx
+ 976:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 979:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 97c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 97f:	89 15 6c 10 00 00    	mov    %edx,0x106c
+}
+ 985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 988:	83 c0 08             	add    $0x8,%eax
+}
+ 98b:	5b                   	pop    %ebx
+ 98c:	5e                   	pop    %esi
+ 98d:	5f                   	pop    %edi
+ 98e:	5d                   	pop    %ebp
+ 98f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 990:	c7 05 6c 10 00 00 70 	movl   $0x1070,0x106c
+ 997:	10 00 00 
+    base.s.size = 0;
+ 99a:	b8 70 10 00 00       	mov    $0x1070,%eax
+    base.s.ptr = freep = prevp = &base;
+ 99f:	c7 05 70 10 00 00 70 	movl   $0x1070,0x1070
+ 9a6:	10 00 00 
+    base.s.size = 0;
+ 9a9:	c7 05 74 10 00 00 00 	movl   $0x0,0x1074
+ 9b0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9b3:	e9 54 ff ff ff       	jmp    90c <malloc+0x2c>
+ 9b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9c0:	8b 08                	mov    (%eax),%ecx
+ 9c2:	89 0a                	mov    %ecx,(%edx)
+ 9c4:	eb b9                	jmp    97f <malloc+0x9f>
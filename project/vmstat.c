@@ -0,0 +1,60 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "vmstat.h"
+
+char *policy[NSWAPPOLICY] = { "legacy", "clock", "aging", "wsclock" };
+
+int
+main(int argc, char *argv[])
+{
+  struct vmstat st;
+  uint below, bfree;
+  int i;
+
+  if(getvmstat(&st) < 0){
+    printf(2, "vmstat: getvmstat failed\n");
+    exit();
+  }
+  printf(1, "free pages      %d (%d in per-cpu caches)\n", st.nfree, st.pcpfree);
+  printf(1, "zero pool       %d (hits %d, misses %d)\n", st.zpool, st.zhits, st.zmisses);
+  printf(1, "faults          cow %d, zero %d, lazy %d, file %d\n",
+         st.cow_faults, st.zero_faults, st.lazy_faults, st.file_faults);
+  printf(1, "page cache      %d pages (hits %d, misses %d)\n",
+         st.pcache_pages, st.pcache_hits, st.pcache_misses);
+  printf(1, "tlb flushes     page %d, range %d, full %d, skipped %d\n",
+         st.tlb_page, st.tlb_range, st.tlb_full, st.tlb_skipped);
+  printf(1, "tlb shootdowns  ipis %d, remote %d\n", st.tlb_ipi, st.tlb_remote);
+  printf(1, "same-page merge scanned %d, saved %d, failed %d\n",
+         st.ksm_scanned, st.ksm_saved, st.ksm_failed);
+  printf(1, "zswap           %d pages hold %d swapped pages in %d bytes (%d to disk)\n",
+         st.zswap_pages, st.zswap_stored, st.zswap_bytes, st.zswap_rejects);
+  printf(1, "swap slots      %d of %d used, longest free run %d\n",
+         st.swap_used, st.swap_slots, st.swap_maxrun);
+  printf(1, "swap cache      %d slots, %d clean evictions, %d shared faults\n",
+         st.swap_cached, st.swap_clean, st.swap_shared);
+  printf(1, "swap i/o        %d reads, %d writes in %d ticks\n",
+         st.swap_reads, st.swap_writes, st.swap_ioticks);
+  printf(1, "swap read-ahead %d pages, %d used\n", st.swap_ra_pages, st.swap_ra_hits);
+  printf(1, "buffer cache    hits %d, misses %d\n", st.bcache_hits, st.bcache_misses);
+  printf(1, "reclaim         kswapd %d pages in %d wakeups, direct %d\n",
+         st.kswapd_pages, st.kswapd_wakeups, st.direct_reclaims);
+  printf(1, "policy  outs  ins  ticks  ins/1000 ticks\n");
+  for(i = 0; i < NSWAPPOLICY; i++)
+    printf(1, "%s%s  %d  %d  %d  %d\n", policy[i], i == st.swap_policy ? "*" : "",
+           st.swap_outs[i], st.swap_ins[i], st.swap_ticks[i],
+           st.swap_ticks[i] ? st.swap_ins[i] * 1000 / st.swap_ticks[i] : 0);
+  printf(1, "rmap bytes      %d (%d pool pages, %d nodes in use)\n",
+         st.rmap_bytes, st.rmap_pages, st.rmap_nodes);
+
+  // Fragmentation: for each order, the share of free memory that sits
+  // in smaller blocks and so cannot satisfy a request of that order.
+  bfree = st.nfree - st.pcpfree - st.zpool;
+  printf(1, "order  blocks  unusable%%\n");
+  below = 0;
+  for(i = 0; i < NORDER; i++){
+    printf(1, "%d  %d  %d\n", i, st.nblocks[i], bfree ? below * 100 / bfree : 0);
+    below += st.nblocks[i] << i;
+  }
+  exit();
+}
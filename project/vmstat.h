@@ -0,0 +1,72 @@
+#define NORDER 11  // buddy allocator orders 0..10
+
+// vmctl commands
+#define VMCTL_HEAPMODE  1  // set how sbrk backs new heap pages
+#define VMCTL_KSM_PAGES 2  // pages merged-page scanner looks at per pass; 0 = off
+#define VMCTL_KSM_SLEEP 3  // ticks the scanner sleeps between passes
+#define VMCTL_SWAPPOLICY 4 // choose the page replacement policy
+
+// Heap modes
+#define HEAP_ZERO  0  // map the shared zero page, copy on first write
+#define HEAP_LAZY  1  // map nothing, allocate on first touch
+#define HEAP_EAGER 2  // allocate and zero every page up front
+
+// Page replacement policies
+#define SWAP_LEGACY  0  // largest process, first page not recently used
+#define SWAP_CLOCK   1  // global second-chance clock over physical pages
+#define SWAP_AGING   2  // evict the oldest of a window of aged pages
+#define SWAP_WSCLOCK 3  // evict a page outside the working set
+#define NSWAPPOLICY  4
+
+// Virtual memory statistics, filled in by the getvmstat system call.
+struct vmstat {
+  uint nfree;          // free physical pages
+  uint pcpfree;        // of which cached in per-CPU magazines
+  uint zpool;          // of which already zeroed
+  uint zhits;          // zeroed allocations served from the pool
+  uint zmisses;        // zeroed allocations that had to clear a page
+  uint nblocks[NORDER];  // free buddy blocks of each order
+  uint rmap_bytes;     // memory used by the reverse map (metadata + node pool)
+  uint rmap_pages;     // pages carved into the rmap node pool
+  uint rmap_nodes;     // overflow nodes currently in use
+  uint cow_faults;     // writes that broke COW sharing
+  uint zero_faults;    // first writes to zero-page-backed heap pages
+  uint lazy_faults;    // first touches of lazily grown heap pages
+  uint file_faults;    // program pages read from the file on first touch
+  uint pcache_pages;   // program pages held by the page cache
+  uint pcache_hits;    // program page faults served from the cache
+  uint pcache_misses;  // program page faults that read the file
+  uint tlb_page;       // single-page TLB invalidations
+  uint tlb_range;      // range invalidations done page by page
+  uint tlb_full;       // full TLB flushes (%cr3 reloads)
+  uint tlb_skipped;    // flushes skipped because pgdir was not loaded
+  uint tlb_ipi;        // shootdown IPIs sent to other CPUs
+  uint tlb_remote;     // addresses invalidated for another CPU
+  uint ksm_scanned;    // user pages hashed by the merging scanner
+  uint ksm_saved;      // frames freed by merging identical pages
+  uint ksm_failed;     // hash matches that were not identical
+  uint zswap_pages;    // pages in the compressed swap pool
+  uint zswap_stored;   // swapped-out pages held compressed in it
+  uint zswap_bytes;    // their compressed size
+  uint zswap_rejects;  // swap-outs that went to disk instead
+  uint swap_slots;     // page-sized slots in the swap area
+  uint swap_used;      // of which holding a page
+  uint swap_maxrun;    // longest run of adjacent free slots
+  uint swap_cached;    // slots kept with a clean copy of a resident page
+  uint swap_clean;     // evictions that had a clean copy and wrote nothing
+  uint swap_shared;    // swap faults served by another's swap-in
+  uint swap_ra_pages;  // pages swapped in ahead of a fault
+  uint swap_ra_hits;   // of which used before the next swap fault
+  uint swap_reads;     // pages read back from the swap area
+  uint swap_writes;    // pages written to it
+  uint swap_ioticks;   // ticks spent on that I/O
+  uint bcache_hits;    // buffer cache lookups that found the block
+  uint bcache_misses;  // lookups that had to recycle a buffer
+  uint kswapd_wakeups; // times the reclaim thread found memory low
+  uint kswapd_pages;   // pages it swapped out
+  uint direct_reclaims; // pages kalloc() had to swap out itself
+  uint swap_policy;    // current page replacement policy
+  uint swap_outs[NSWAPPOLICY];   // pages evicted under each policy
+  uint swap_ins[NSWAPPOLICY];    // swapped-out pages faulted back in
+  uint swap_ticks[NSWAPPOLICY];  // ticks each policy has been in use
+};
@@ -130,6 +130,14 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Atomically increment *addr. Used for statistics counters
+// that are bumped on several CPUs without a lock.
+static inline void
+atomic_inc(volatile uint *addr)
+{
+  asm volatile("lock; incl %0" : "+m" (*addr) : : "cc");
+}
+
 // The following command is used to read the value of the CR2 register. -> Gives info about the page fault.
 static inline uint
 rcr2(void)
@@ -146,6 +154,21 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr3(void)
+{
+  uint val;
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+  return val;
+}
+
+// Drop the TLB entry for the page containing addr.
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
@@ -0,0 +1,294 @@
+// Compressed swap cache. swap_out_batch() first tries to compress a
+// victim into a pool of pages kept here; only a page that does not
+// compress well, or that finds the pool full, is written to its swap
+// slot on disk. Either way the PTEs name the swap slot, and the slot
+// records where the data is, so swapping back in from the pool costs
+// a decompression instead of eight disk reads.
+//
+// The pool grows by keeping victims that had to go to disk for lack
+// of room, and a pool page is given back as soon as it is empty.
+// Compressed pages are stored in 64-byte chunks and never straddle a
+// pool page.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "vmstat.h"
+
+#define ZPOOL_MAX   64   // pool pages
+#define ZCHUNK      64   // allocation unit within a pool page
+#define ZNCHUNK     (PGSIZE / ZCHUNK)
+#define ZMAXLEN     (PGSIZE - PGSIZE / 4)  // worse than this goes to disk
+#define ZHASHBITS   10
+#define ZMINMATCH   4
+#define ZMAXMATCH   (0x7f + ZMINMATCH)
+
+struct zpage {
+  char *page;          // 0 if unused
+  uint map[ZNCHUNK / 32];  // chunks in use
+  int nused;
+};
+
+struct {
+  struct spinlock lock;
+  struct zpage zp[ZPOOL_MAX];
+  int npages;          // pool pages
+  uint stored;         // pages held compressed
+  uint bytes;          // compressed bytes held
+  uint rejects;        // stores that went to disk instead
+  ushort hash[1 << ZHASHBITS];  // compressor state
+  uchar buf[ZMAXLEN];  // compressor output
+} zswap;
+
+void
+zswapinit(void)
+{
+  initlock(&zswap.lock, "zswap");
+}
+
+// Compressed format: a control byte c < 0x80 is followed by c literal
+// bytes; c >= 0x80 is a match of (c & 0x7f) + ZMINMATCH bytes copied
+// from a 16-bit little-endian distance back in the output.
+
+static int
+lz_literals(uchar *p, int n, uchar *out, int o, int max)
+{
+  int k;
+
+  while(n > 0){
+    k = n > 0x7f ? 0x7f : n;
+    if(o + 1 + k > max)
+      return -1;
+    out[o++] = k;
+    memmove(out + o, p, k);
+    o += k;
+    p += k;
+    n -= k;
+  }
+  return o;
+}
+
+// Compress a page from in to out. Returns the compressed length, or
+// -1 if it would be longer than max.
+static int
+lz_compress(uchar *in, uchar *out, int max)
+{
+  uint v, h;
+  int i, lit, o, cand, len;
+
+  memset(zswap.hash, 0, sizeof(zswap.hash));
+  i = lit = o = 0;
+  while(i + ZMINMATCH <= PGSIZE){
+    v = *(uint*)(in + i);
+    h = (v * 2654435761U) >> (32 - ZHASHBITS);
+    cand = zswap.hash[h] - 1;
+    zswap.hash[h] = i + 1;
+    if(cand < 0 || *(uint*)(in + cand) != v){
+      i++;
+      continue;
+    }
+    len = ZMINMATCH;
+    while(i + len < PGSIZE && len < ZMAXMATCH && in[cand + len] == in[i + len])
+      len++;
+    if((o = lz_literals(in + lit, i - lit, out, o, max)) < 0 || o + 3 > max)
+      return -1;
+    out[o++] = 0x80 | (len - ZMINMATCH);
+    out[o++] = (i - cand) & 0xff;
+    out[o++] = (i - cand) >> 8;
+    i += len;
+    lit = i;
+  }
+  return lz_literals(in + lit, PGSIZE - lit, out, o, max);
+}
+
+static void
+lz_decompress(uchar *in, int n, uchar *out)
+{
+  int i, o, c, len, off;
+
+  i = o = 0;
+  while(i < n){
+    c = in[i++];
+    if(c & 0x80){
+      len = (c & 0x7f) + ZMINMATCH;
+      off = in[i] | (in[i + 1] << 8);
+      i += 2;
+      if(off == 0 || off > o || o + len > PGSIZE)
+        panic("lz_decompress");
+      for(; len > 0; len--, o++)
+        out[o] = out[o - off];  // may overlap: copy forwards
+    } else {
+      if(o + c > PGSIZE || i + c > n)
+        panic("lz_decompress");
+      memmove(out + o, in + i, c);
+      o += c;
+      i += c;
+    }
+  }
+  if(o != PGSIZE)
+    panic("lz_decompress: short");
+}
+
+static int
+zchunk_used(struct zpage *z, int c)
+{
+  return (z->map[c / 32] >> (c % 32)) & 1;
+}
+
+static void
+zchunk_set(struct zpage *z, int c, int n, int used)
+{
+  for(; n > 0; n--, c++){
+    if(used)
+      z->map[c / 32] |= 1 << (c % 32);
+    else
+      z->map[c / 32] &= ~(1 << (c % 32));
+  }
+}
+
+// Find n free chunks in a row. Must hold zswap.lock.
+static char*
+zalloc(int n)
+{
+  struct zpage *z;
+  int c, k;
+
+  for(z = zswap.zp; z < &zswap.zp[ZPOOL_MAX]; z++){
+    if(z->page == 0 || ZNCHUNK - z->nused < n)
+      continue;
+    for(c = 0; c + n <= ZNCHUNK; c += k + 1){
+      for(k = 0; k < n && !zchunk_used(z, c + k); k++)
+        ;
+      if(k == n){
+        zchunk_set(z, c, n, 1);
+        z->nused += n;
+        return z->page + c * ZCHUNK;
+      }
+    }
+  }
+  return 0;
+}
+
+// Drop slot's compressed copy. Returns its pool page if that is now
+// empty and has been taken out of the pool; the caller frees it once it
+// has released zswap.lock. Must hold zswap.lock.
+static char*
+zrelease(struct swap_slot *slot)
+{
+  struct zpage *z;
+  char *page = (char*)PGROUNDDOWN((uint)slot->zdata);
+  int n = (slot->zlen + ZCHUNK - 1) / ZCHUNK;
+
+  for(z = zswap.zp; z->page != page; z++)
+    ;
+  zchunk_set(z, (slot->zdata - page) / ZCHUNK, n, 0);
+  z->nused -= n;
+  zswap.stored -= 1;
+  zswap.bytes -= slot->zlen;
+  slot->zdata = 0;
+  slot->zlen = 0;
+  if(z->nused > 0)
+    return 0;
+  z->page = 0;
+  zswap.npages -= 1;
+  return page;
+}
+
+// Compress page into the pool on behalf of slot. Returns -1 if the
+// page does not compress well enough, or -2 if it did but there is no
+// room; either way the caller then writes it to disk.
+int
+zswap_store(char *page, struct swap_slot *slot)
+{
+  int n;
+  char *d;
+
+  acquire(&zswap.lock);
+  if((n = lz_compress((uchar*)page, zswap.buf, ZMAXLEN)) < 0){
+    zswap.rejects += 1;
+    release(&zswap.lock);
+    return -1;
+  }
+  if((d = zalloc((n + ZCHUNK - 1) / ZCHUNK)) == 0){
+    zswap.rejects += 1;
+    release(&zswap.lock);
+    return -2;
+  }
+  memmove(d, zswap.buf, n);
+  slot->zdata = d;
+  slot->zlen = n;
+  zswap.stored += 1;
+  zswap.bytes += n;
+  release(&zswap.lock);
+  return 0;
+}
+
+// Decompress slot's page into mem and drop it from the pool.
+void
+zswap_load(char *mem, struct swap_slot *slot)
+{
+  char *empty;
+
+  acquire(&zswap.lock);
+  lz_decompress((uchar*)slot->zdata, slot->zlen, (uchar*)mem);
+  empty = zrelease(slot);
+  release(&zswap.lock);
+  if(empty)
+    kfree(empty);
+}
+
+// slot is being freed: drop its compressed copy, if it has one.
+void
+zswap_free(struct swap_slot *slot)
+{
+  char *empty;
+
+  if(slot->zdata == 0)
+    return;
+  acquire(&zswap.lock);
+  empty = zrelease(slot);
+  release(&zswap.lock);
+  if(empty)
+    kfree(empty);
+}
+
+// Offered a victim frame that went to disk because zswap_store() found
+// no room for it: keep it as a pool page. Only a frame nobody maps,
+// holds or has pinned is taken; the caller frees the others as usual.
+// Returns 1 if the page was taken.
+int
+zswap_grow(char *page)
+{
+  struct zpage *z;
+
+  if(get_count_ref(V2P(page)) != 0 || kpinned(V2P(page)))
+    return 0;
+  acquire(&zswap.lock);
+  if(zswap.npages == ZPOOL_MAX){
+    release(&zswap.lock);
+    return 0;
+  }
+  for(z = zswap.zp; z->page; z++)
+    ;
+  z->page = page;
+  memset(z->map, 0, sizeof(z->map));
+  z->nused = 0;
+  zswap.npages += 1;
+  release(&zswap.lock);
+  return 1;
+}
+
+void
+zswapstat(struct vmstat *st)
+{
+  acquire(&zswap.lock);
+  st->zswap_pages = zswap.npages;
+  st->zswap_stored = zswap.stored;
+  st->zswap_bytes = zswap.bytes;
+  st->zswap_rejects = zswap.rejects;
+  release(&zswap.lock);
+}